@@ -0,0 +1,61 @@
+//
+//  AllocationCounter.c
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include "AllocationCounter.h"
+
+#if defined(__GLIBC__)
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+
+/// Allocations made by every thread.
+static atomic_uint_fast64_t allocations = 0;
+
+/*
+ The benchmark executable defines the allocator entry points, so every
+ allocation in the process, including those made by libobjc2,
+ gnustep-base and libdispatch, passes through here.
+ */
+
+void *malloc(size_t size) {
+    atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) {
+    if (pointer == NULL) atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    return __libc_realloc(pointer, size);
+}
+
+bool AllocationCountingAvailable(void) {
+    return true;
+}
+
+uint64_t AllocationCount(void) {
+    return atomic_load_explicit(&allocations, memory_order_relaxed);
+}
+
+#else
+
+bool AllocationCountingAvailable(void) {
+    return false;
+}
+
+uint64_t AllocationCount(void) {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,32 @@
+//
+//  AllocationCounter.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef AllocationCounter_h
+#define AllocationCounter_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ Whether heap allocations are being counted.
+
+ Counting replaces `malloc`, `calloc` and `realloc` with wrappers around
+ the glibc allocator, so it is only available when linked against glibc.
+
+ @return true if `AllocationCount` counts allocations.
+ */
+bool AllocationCountingAvailable(void);
+
+/**
+ The number of heap allocations made by the process so far, on any thread.
+
+ @return The allocation count, or 0 when counting is unavailable.
+ */
+uint64_t AllocationCount(void);
+
+#endif /* AllocationCounter_h */
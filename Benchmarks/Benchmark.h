@@ -0,0 +1,109 @@
+//
+//  Benchmark.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The measurements of one `Benchmark`.
+ */
+@interface BenchmarkResult : NSObject
+
+/// The benchmark's name.
+@property (nonatomic, copy, readonly) NSString *name;
+
+/// Operations timed per sample.
+@property (nonatomic, readonly) uint64_t iterations;
+
+/// Number of samples taken.
+@property (nonatomic, readonly) NSUInteger samples;
+
+/// Median time per operation across samples, in nanoseconds.
+@property (nonatomic, readonly) double nsPerOp;
+
+/// Fastest and slowest sample, in nanoseconds per operation.
+@property (nonatomic, readonly) double minNsPerOp;
+@property (nonatomic, readonly) double maxNsPerOp;
+
+/// Heap allocations per operation, or a negative value when allocations are not counted.
+@property (nonatomic, readonly) double allocsPerOp;
+
+/**
+ Designated initializer.
+
+ @param name The benchmark's name.
+ @param iterations Operations timed per sample.
+ @param nanoseconds The duration of each sample, in nanoseconds.
+ @param allocations Allocations across all samples, or a negative value when not counted.
+ @return An initialized `BenchmarkResult`.
+ */
+- (instancetype)initWithName:(NSString *)name iterations:(uint64_t)iterations nanoseconds:(NSArray<NSNumber *> *)nanoseconds allocations:(double)allocations;
+
+/// The result as a JSON-compatible dictionary.
+- (NSDictionary<NSString *, id> *)dictionary;
+
+@end
+
+/**
+ A micro-benchmark of one operation.
+
+ The operation block runs a given number of iterations of the measured
+ operation, so block invocation is amortized. The optional setup block
+ prepares a context for that many iterations outside the timed region,
+ and the teardown block disposes of it.
+
+ `runWithTargetTime:samples:` doubles the iteration count until a
+ single run takes the target time, then times that many iterations
+ per sample.
+ */
+@interface Benchmark : NSObject
+
+/// The benchmark's name.
+@property (nonatomic, copy, readonly) NSString *name;
+
+/**
+ Factory method for a benchmark without setup.
+
+ @param name The benchmark's name.
+ @param operation Runs the given number of iterations.
+ @return A new `Benchmark`.
+ */
++ (instancetype)withName:(NSString *)name operation:(void (^)(uint64_t iterations))operation;
+
+/**
+ Factory method for a benchmark with untimed setup and teardown.
+
+ @param name The benchmark's name.
+ @param setup Prepares a context for the given number of iterations.
+ @param operation Runs the given number of iterations using the context.
+ @param teardown Disposes of the context.
+ @return A new `Benchmark`.
+ */
++ (instancetype)withName:(NSString *)name
+                   setup:(id _Nullable (^)(uint64_t iterations))setup
+               operation:(void (^)(id _Nullable context, uint64_t iterations))operation
+                teardown:(nullable void (^)(id _Nullable context))teardown;
+
+/**
+ Calibrate and measure the benchmark.
+
+ @param seconds The minimum duration of a sample.
+ @param samples The number of samples to take.
+ @return The measurements.
+ */
+- (BenchmarkResult *)runWithTargetTime:(double)seconds samples:(NSUInteger)samples;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Benchmark_h */
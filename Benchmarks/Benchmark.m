@@ -0,0 +1,136 @@
+//
+//  Benchmark.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import "Benchmark.h"
+#import "Instrumentation.h"
+#import "AllocationCounter.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation BenchmarkResult
+
+- (instancetype)initWithName:(NSString *)name iterations:(uint64_t)iterations nanoseconds:(NSArray<NSNumber *> *)nanoseconds allocations:(double)allocations {
+    if (self = [super init]) {
+        _name = [name copy];
+        _iterations = iterations;
+        _samples = nanoseconds.count;
+        NSArray<NSNumber *> *sorted = [nanoseconds sortedArrayUsingSelector:@selector(compare:)];
+        _nsPerOp = sorted[sorted.count / 2].doubleValue / (double)iterations;
+        _minNsPerOp = sorted.firstObject.doubleValue / (double)iterations;
+        _maxNsPerOp = sorted.lastObject.doubleValue / (double)iterations;
+        _allocsPerOp = allocations < 0 ? -1 : allocations / (double)(iterations * nanoseconds.count);
+    }
+    return self;
+}
+
+- (NSDictionary<NSString *, id> *)dictionary {
+    return @{
+        @"name": self.name,
+        @"iterations": @(self.iterations),
+        @"samples": @(self.samples),
+        @"ns_per_op": @(self.nsPerOp),
+        @"min_ns_per_op": @(self.minNsPerOp),
+        @"max_ns_per_op": @(self.maxNsPerOp),
+        @"allocs_per_op": self.allocsPerOp < 0 ? [NSNull null] : @(self.allocsPerOp)
+    };
+}
+
+@end
+
+@interface Benchmark()
+
+@property (nonatomic, copy, readonly, nullable) id (^setup)(uint64_t iterations);
+@property (nonatomic, copy, readonly) void (^operation)(id _Nullable context, uint64_t iterations);
+@property (nonatomic, copy, readonly, nullable) void (^teardown)(id _Nullable context);
+
+@end
+
+/**
+A micro-benchmark of one operation.
+
+Each run prepares its context, then reads the clock and the allocation
+count immediately around the operation block, so setup, teardown and
+calibration never show up in the results.
+*/
+@implementation Benchmark
+
++ (instancetype)withName:(NSString *)name operation:(void (^)(uint64_t iterations))operation {
+    return [[self alloc] initWithName:name setup:nil operation:^(id context, uint64_t iterations) { operation(iterations); } teardown:nil];
+}
+
++ (instancetype)withName:(NSString *)name
+                   setup:(id _Nullable (^)(uint64_t iterations))setup
+               operation:(void (^)(id _Nullable context, uint64_t iterations))operation
+                teardown:(nullable void (^)(id _Nullable context))teardown {
+    return [[self alloc] initWithName:name setup:setup operation:operation teardown:teardown];
+}
+
+- (instancetype)initWithName:(NSString *)name
+                       setup:(nullable id (^)(uint64_t iterations))setup
+                   operation:(void (^)(id _Nullable context, uint64_t iterations))operation
+                    teardown:(nullable void (^)(id _Nullable context))teardown {
+    if (self = [super init]) {
+        _name = [name copy];
+        _setup = [setup copy];
+        _operation = [operation copy];
+        _teardown = [teardown copy];
+    }
+    return self;
+}
+
+/**
+Time one run.
+
+- parameter iterations: the number of operations to run
+- parameter allocations: receives the allocations made by the operation, if not NULL
+- returns: the duration of the operation block, in nanoseconds
+*/
+- (uint64_t)run:(uint64_t)iterations allocations:(nullable uint64_t *)allocations {
+    uint64_t elapsed = 0;
+    @autoreleasepool {
+        id context = self.setup != nil ? self.setup(iterations) : nil;
+        uint64_t allocationsBefore = AllocationCount();
+        uint64_t start = InstrumentationNow();
+        self.operation(context, iterations);
+        elapsed = InstrumentationNow() - start;
+        if (allocations != NULL) *allocations = AllocationCount() - allocationsBefore;
+        if (self.teardown != nil) self.teardown(context);
+    }
+    return elapsed;
+}
+
+/**
+Calibrate and measure the benchmark.
+
+- parameter seconds: the minimum duration of a sample
+- parameter samples: the number of samples to take
+- returns: the measurements
+*/
+- (BenchmarkResult *)runWithTargetTime:(double)seconds samples:(NSUInteger)samples {
+    uint64_t target = (uint64_t)(seconds * NSEC_PER_SEC);
+    uint64_t iterations = 1;
+    while ([self run:iterations allocations:NULL] < target && iterations < (1ULL << 40)) {
+        iterations *= 2;
+    }
+    
+    NSMutableArray<NSNumber *> *nanoseconds = [NSMutableArray arrayWithCapacity:samples];
+    uint64_t allocations = 0;
+    for (NSUInteger i = 0; i < MAX(samples, (NSUInteger)1); i++) {
+        uint64_t sampleAllocations = 0;
+        [nanoseconds addObject:@([self run:iterations allocations:&sampleAllocations])];
+        allocations += sampleAllocations;
+    }
+    
+    return [[BenchmarkResult alloc] initWithName:self.name iterations:iterations nanoseconds:nanoseconds
+                                     allocations:AllocationCountingAvailable() ? (double)allocations : -1];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
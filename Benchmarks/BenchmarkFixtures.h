@@ -0,0 +1,128 @@
+//
+//  BenchmarkFixtures.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef BenchmarkFixtures_h
+#define BenchmarkFixtures_h
+
+#import <Foundation/Foundation.h>
+#import <pthread.h>
+#import "PureMVC.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The notification the fixtures observe and handle.
+FOUNDATION_EXPORT NSString *const BenchmarkNotification;
+
+/// The notification `BenchmarkSendingCommand` is registered for.
+FOUNDATION_EXPORT NSString *const BenchmarkSendingNotification;
+
+FOUNDATION_EXPORT NSString *const BenchmarkReplyNotification;
+
+/**
+ A unique multiton key, so repeated runs never collide with a Core
+ that has not been removed yet.
+
+ @param prefix Describes the benchmark using the key.
+ @return A key not returned before.
+ */
+FOUNDATION_EXPORT NSString *BenchmarkKey(NSString *prefix);
+
+/**
+ Start a thread running a block inside an autorelease pool.
+
+ @param block The block to run.
+ @return The thread, to be joined.
+ */
+FOUNDATION_EXPORT pthread_t BenchmarkStartThread(void (^block)(void));
+
+/// An observer context that does nothing with the notification.
+@interface BenchmarkReceiver : NSObject
+
+/// Observer notification method.
+- (void)onNotification:(id<INotification>)notification;
+
+@end
+
+/// A `Mediator` interested in `BenchmarkNotification` that ignores it.
+/**
+ An observer counting the notifications it receives, for benchmarks
+ that deliver on another thread.
+ */
+@interface BenchmarkCounter : NSObject
+
+/**
+ Reset the count and set the number of notifications to await.
+
+ @param count The number of notifications `await` returns after.
+ */
+- (void)expect:(uint64_t)count;
+
+/**
+ Wait for the expected number of notifications, at most ten seconds.
+
+ @return YES if they were all received.
+ */
+- (BOOL)await;
+
+- (void)onNotification:(id<INotification>)notification;
+
+@end
+
+/**
+ An observer answering every notification with a
+ `BenchmarkReplyNotification` written to the pipe of another Core.
+ */
+@interface BenchmarkReplier : NSObject
+
+/// The multiton key of the Core to answer.
+@property (nonatomic, copy) NSString *replyKey;
+
+- (void)onNotification:(id<INotification>)notification;
+
+@end
+
+@interface BenchmarkMediator : Mediator <NSCopying>
+
+@end
+
+/// A `Proxy` with no data.
+@interface BenchmarkProxy : Proxy
+
+@end
+
+/**
+ A Proxy that parses 100000 integers from JSON in `onRegister`, unless
+ it was restored from a snapshot.
+ */
+@interface BenchmarkSnapshotProxy : Proxy <ISnapshotProxy>
+
+@end
+
+/// A `SimpleCommand` that does nothing.
+@interface BenchmarkCommand : SimpleCommand
+
+@end
+
+/// A `SimpleCommand` that retrieves `BenchmarkProxy` and sends `BenchmarkNotification` through its facade.
+@interface BenchmarkSendingCommand : SimpleCommand
+
+@end
+
+/// A `BenchmarkSendingCommand` looking its facade up in the registry on every access, as notifiers did before caching it.
+@interface BenchmarkLookupCommand : BenchmarkSendingCommand
+
+@end
+
+/// A `MacroCommand` of three `BenchmarkCommand`s.
+@interface BenchmarkMacroCommand : MacroCommand
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* BenchmarkFixtures_h */
@@ -0,0 +1,182 @@
+//
+//  BenchmarkFixtures.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <stdatomic.h>
+#import "BenchmarkFixtures.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+NSString *const BenchmarkNotification = @"BenchmarkNotification";
+
+NSString *const BenchmarkSendingNotification = @"BenchmarkSendingNotification";
+
+NSString *const BenchmarkReplyNotification = @"BenchmarkReplyNotification";
+
+NSString *BenchmarkKey(NSString *prefix) {
+    static atomic_uint_fast64_t counter = 0;
+    return [NSString stringWithFormat:@"Benchmark.%@.%llu", prefix, (unsigned long long)atomic_fetch_add(&counter, 1)];
+}
+
+/**
+Run a block on a new thread, inside an autorelease pool.
+
+- parameter argument: the retained block
+- returns: NULL
+*/
+static void *runBlock(void *argument) {
+    @autoreleasepool {
+        void (^block)(void) = CFBridgingRelease(argument);
+        block();
+    }
+    return NULL;
+}
+
+pthread_t BenchmarkStartThread(void (^block)(void)) {
+    pthread_t thread;
+    pthread_create(&thread, NULL, runBlock, (void *)CFBridgingRetain([block copy]));
+    return thread;
+}
+
+@implementation BenchmarkReceiver
+
+- (void)onNotification:(id<INotification>)notification {
+    
+}
+
+@end
+
+@implementation BenchmarkCounter {
+    atomic_uint_fast64_t _received;
+    atomic_uint_fast64_t _expected;
+    dispatch_semaphore_t _done;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _done = dispatch_semaphore_create(0);
+    }
+    return self;
+}
+
+- (void)expect:(uint64_t)count {
+    atomic_store(&_received, 0);
+    atomic_store(&_expected, count);
+}
+
+- (BOOL)await {
+    return dispatch_semaphore_wait(_done, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)) == 0;
+}
+
+- (void)onNotification:(id<INotification>)notification {
+    if (atomic_fetch_add(&_received, 1) + 1 == atomic_load(&_expected)) dispatch_semaphore_signal(_done);
+}
+
+@end
+
+@implementation BenchmarkReplier
+
+- (void)onNotification:(id<INotification>)notification {
+    [Pipe write:[Notification withName:BenchmarkReplyNotification] toCore:self.replyKey];
+}
+
+@end
+
+@implementation BenchmarkMediator
+
+- (NSArray<NSString *> *)listNotificationInterests {
+    return @[BenchmarkNotification];
+}
+
+- (void)handleNotification:(id<INotification>)notification {
+    
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+    BenchmarkMediator *mediator = [BenchmarkMediator withName:self.name];
+    mediator.component = self.component;
+    return mediator;
+}
+
+@end
+
+@implementation BenchmarkProxy
+
+@end
+
+@implementation BenchmarkSnapshotProxy
+
++ (NSString *)NAME { return @"BenchmarkSnapshotProxy"; }
+
++ (NSData *)payload {
+    static NSData *payload = nil;
+    static dispatch_once_t once;
+    dispatch_once(&once, ^{
+        NSMutableArray *values = [NSMutableArray arrayWithCapacity:100000];
+        for (int i = 0; i < 100000; i++) [values addObject:@(i)];
+        payload = [NSJSONSerialization dataWithJSONObject:values options:0 error:nil];
+    });
+    return payload;
+}
+
+- (void)onRegister {
+    // restored from a snapshot, nothing to load
+    if (self.data != nil) return;
+    
+    NSArray<NSNumber *> *values = [NSJSONSerialization JSONObjectWithData:[BenchmarkSnapshotProxy payload] options:0 error:nil];
+    NSMutableData *data = [NSMutableData dataWithLength:values.count * sizeof(int32_t)];
+    int32_t *ints = data.mutableBytes;
+    for (NSUInteger i = 0; i < values.count; i++) ints[i] = [values[i] intValue];
+    self.data = data;
+}
+
+- (nullable NSData *)snapshotData {
+    return self.data;
+}
+
+- (void)restoreSnapshotData:(NSData *)data {
+    self.data = data;
+}
+
+@end
+
+@implementation BenchmarkCommand
+
+- (void)execute:(id<INotification>)notification {
+    
+}
+
+@end
+
+@implementation BenchmarkSendingCommand
+
+- (void)execute:(id<INotification>)notification {
+    [self.facade retrieveProxy:@"BenchmarkProxy"];
+    [self sendNotification:BenchmarkNotification];
+}
+
+@end
+
+@implementation BenchmarkLookupCommand
+
+- (nullable id<IFacade>)facade {
+    return [Facade getInstance:self.multitonKey factory:^(NSString *key) { return [Facade withKey:key]; }];
+}
+
+@end
+
+@implementation BenchmarkMacroCommand
+
+- (void)initializeMacroCommand {
+    [self addSubCommand:^id<ICommand> { return [BenchmarkCommand command]; }];
+    [self addSubCommand:^id<ICommand> { return [BenchmarkCommand command]; }];
+    [self addSubCommand:^id<ICommand> { return [BenchmarkCommand command]; }];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
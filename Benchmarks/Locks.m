@@ -0,0 +1,237 @@
+//
+//  Locks.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <pthread.h>
+#import <sched.h>
+#import <stdatomic.h>
+#import <time.h>
+#import "PureMVC.h"
+#import "BenchmarkFixtures.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+enum {
+    /// Proxies, mediators and commands registered for the whole phase.
+    LocksRegistrations = 10
+};
+
+/// Start and stop signals shared by the threads of one phase.
+typedef struct {
+    atomic_uint ready;
+    atomic_bool go;
+    atomic_bool stop;
+    atomic_uint_fast64_t operations;
+} LocksSignals;
+
+/// A strategy and its name in the report.
+typedef struct {
+    MapLockStrategy strategy;
+    const char *name;
+} LocksStrategy;
+
+/// The strategies compared; confined Cores cannot be shared between threads.
+static const LocksStrategy strategies[] = {
+    { MapLockStrategyDispatch, "dispatch" },
+    { MapLockStrategyReadWrite, "rwlock" },
+    { MapLockStrategySpin, "spin" },
+    { MapLockStrategyReadMostly, "read-mostly" },
+};
+
+/// A mix of operations and its name in the report.
+typedef struct {
+    unsigned readPercent;
+    const char *name;
+} LocksMix;
+
+/// The mixes compared.
+static const LocksMix mixes[] = {
+    { 95, "read-heavy" },
+    { 50, "write-heavy" },
+};
+
+/**
+Advance a xorshift generator.
+
+- parameter state: the generator's state, nonzero
+- returns: the next value
+*/
+static inline uint64_t nextRandom(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+/**
+Run one phase: `threads` threads run a mix of reads and writes on the
+maps of one Core using a strategy.
+
+Reads look up a proxy, a mediator or a command. Writes register or
+remove a proxy of the thread's own.
+
+- parameter strategy: the Core's strategy
+- parameter mix: the mix of reads and writes
+- parameter threads: the number of threads
+- parameter seconds: how long the phase runs
+- returns: the operations per second
+*/
+static double runPhase(MapLockStrategy strategy, LocksMix mix, NSUInteger threads, double seconds) {
+    NSString *key = BenchmarkKey(@"locks");
+    id<IFacade> facade = [Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k mapLockStrategy:strategy]; }];
+    NSMutableArray<NSString *> *names = [NSMutableArray arrayWithCapacity:LocksRegistrations];
+    for (NSUInteger i = 0; i < LocksRegistrations; i++) {
+        NSString *name = [NSString stringWithFormat:@"Registered%lu", (unsigned long)i];
+        [names addObject:name];
+        [facade registerProxy:[BenchmarkProxy withName:name]];
+        [facade registerMediator:[BenchmarkMediator withName:name]];
+        [facade registerCommand:name factory:^id<ICommand> { return [BenchmarkCommand command]; }];
+    }
+
+    LocksSignals *signals = calloc(1, sizeof(LocksSignals));
+    pthread_t *workers = calloc(threads, sizeof(pthread_t));
+    for (NSUInteger t = 0; t < threads; t++) {
+        workers[t] = BenchmarkStartThread(^{
+            NSString *ownName = [NSString stringWithFormat:@"Writer%lu", (unsigned long)t];
+            uint64_t random = 0x9E3779B97F4A7C15ULL * (t + 1);
+            uint64_t operations = 0;
+            BOOL registered = NO;
+            atomic_fetch_add(&signals->ready, 1);
+            while (!atomic_load_explicit(&signals->go, memory_order_acquire)) sched_yield();
+            while (!atomic_load_explicit(&signals->stop, memory_order_relaxed)) {
+                @autoreleasepool {
+                    uint64_t r = nextRandom(&random);
+                    if (r % 100 < mix.readPercent) {
+                        NSString *name = names[(r >> 8) % LocksRegistrations];
+                        switch ((r >> 16) % 3) {
+                            case 0: [facade retrieveProxy:name]; break;
+                            case 1: [facade hasMediator:name]; break;
+                            default: [facade hasCommand:name]; break;
+                        }
+                    } else if (registered) {
+                        [facade removeProxy:ownName];
+                        registered = NO;
+                    } else {
+                        [facade registerProxy:[BenchmarkProxy withName:ownName]];
+                        registered = YES;
+                    }
+                }
+                operations++;
+            }
+            atomic_fetch_add(&signals->operations, operations);
+        });
+    }
+
+    while (atomic_load(&signals->ready) < threads) sched_yield();
+    uint64_t start = InstrumentationNow();
+    atomic_store_explicit(&signals->go, true, memory_order_release);
+    struct timespec duration = { (time_t)seconds, (long)((seconds - (time_t)seconds) * NSEC_PER_SEC) };
+    while (nanosleep(&duration, &duration) != 0);
+    atomic_store_explicit(&signals->stop, true, memory_order_relaxed);
+    for (NSUInteger t = 0; t < threads; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    double elapsed = (double)(InstrumentationNow() - start) / NSEC_PER_SEC;
+    uint64_t operations = atomic_load(&signals->operations);
+    free(workers);
+    free(signals);
+    [Facade removeCore:key];
+    return (double)operations / elapsed;
+}
+
+/**
+Print usage to standard error.
+*/
+static void usage(void) {
+    fprintf(stderr,
+            "usage: pmvc-locks [--threads <n>] [--duration <ms>] [--json <path>|-]\n"
+            "  --threads <n>            the most threads, default the number of active cores\n"
+            "  --duration <ms>          duration of each phase, default 500\n"
+            "  --json <path>|-          write results as JSON to <path>, or to standard output\n");
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        NSUInteger threads = [[NSProcessInfo processInfo] activeProcessorCount];
+        double seconds = 0.5;
+        NSString *jsonPath = nil;
+
+        for (int i = 1; i < argc; i++) {
+            NSString *option = @(argv[i]);
+            BOOL hasValue = i + 1 < argc;
+            if ([option isEqualToString:@"--threads"] && hasValue) {
+                threads = (NSUInteger)MAX(atoi(argv[++i]), 1);
+            } else if ([option isEqualToString:@"--duration"] && hasValue) {
+                seconds = atof(argv[++i]) / 1000.0;
+            } else if ([option isEqualToString:@"--json"] && hasValue) {
+                jsonPath = @(argv[++i]);
+            } else {
+                usage();
+                return [option isEqualToString:@"--help"] ? 0 : 2;
+            }
+        }
+
+        // one thread, then every thread
+        NSMutableArray<NSNumber *> *steps = [NSMutableArray arrayWithObject:@1];
+        if (threads > 1) [steps addObject:@(threads)];
+
+        FILE *table = [jsonPath isEqualToString:@"-"] ? stderr : stdout;
+        fprintf(table, "%-12s %-12s %8s %14s %12s\n", "mix", "strategy", "threads", "ops/s", "vs dispatch");
+
+        NSMutableArray<NSDictionary *> *results = [NSMutableArray array];
+        for (size_t m = 0; m < sizeof(mixes) / sizeof(mixes[0]); m++) {
+            for (NSNumber *step in steps) {
+                double baseline = 0;
+                for (size_t s = 0; s < sizeof(strategies) / sizeof(strategies[0]); s++) {
+                    double throughput = runPhase(strategies[s].strategy, mixes[m], step.unsignedIntegerValue, seconds);
+                    if (s == 0) baseline = throughput;
+                    double relative = baseline > 0 ? throughput / baseline : 0;
+                    [results addObject:@{
+                        @"mix": @(mixes[m].name),
+                        @"read_percent": @(mixes[m].readPercent),
+                        @"strategy": @(strategies[s].name),
+                        @"threads": step,
+                        @"ops_per_sec": @(throughput),
+                        @"vs_dispatch": @(relative)
+                    }];
+                    fprintf(table, "%-12s %-12s %8lu %14.0f %12.2f\n", mixes[m].name, strategies[s].name,
+                            (unsigned long)step.unsignedIntegerValue, throughput, relative);
+                }
+            }
+        }
+
+        if (jsonPath != nil) {
+            NSDictionary *report = @{
+                @"suite": @"puremvc-objectivec-multicore-locks",
+                @"timestamp": @((long long)[[NSDate date] timeIntervalSince1970]),
+                @"host": @{
+                    @"os": [[NSProcessInfo processInfo] operatingSystemVersionString],
+                    @"cpus": @([[NSProcessInfo processInfo] activeProcessorCount])
+                },
+                @"config": @{
+                    @"duration_ms": @(seconds * 1000.0),
+                    @"flight_recorder": @(FlightRecorder.isEnabled)
+                },
+                @"results": results
+            };
+            NSError *error = nil;
+            NSData *json = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:&error];
+            if ([jsonPath isEqualToString:@"-"]) {
+                fwrite(json.bytes, 1, json.length, stdout);
+                fputc('\n', stdout);
+            } else if (![json writeToFile:jsonPath options:NSDataWritingAtomic error:&error]) {
+                fprintf(stderr, "pmvc-locks: %s\n", error.localizedDescription.UTF8String);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+NS_ASSUME_NONNULL_END
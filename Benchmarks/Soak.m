@@ -0,0 +1,146 @@
+//
+//  Soak.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <stdio.h>
+#import <unistd.h>
+#if defined(__APPLE__)
+#import <mach/mach.h>
+#endif
+#import "PureMVC.h"
+#import "BenchmarkFixtures.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+The memory footprint of the process.
+
+- returns: the physical footprint on Darwin, the resident set size elsewhere, in bytes, or 0 if unavailable
+*/
+static uint64_t footprint(void) {
+#if defined(__APPLE__)
+    task_vm_info_data_t info;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) return 0;
+    return info.phys_footprint;
+#else
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (statm == NULL) return 0;
+    unsigned long long size = 0, resident = 0;
+    int fields = fscanf(statm, "%llu %llu", &size, &resident);
+    fclose(statm);
+    return fields == 2 ? resident * (uint64_t)sysconf(_SC_PAGESIZE) : 0;
+#endif
+}
+
+/**
+Create and remove Cores, each with a proxy, a mediator and a command.
+
+- parameter count: the number of Cores
+*/
+static void cycle(uint64_t count) {
+    for (uint64_t i = 0; i < count; i++) {
+        @autoreleasepool {
+            NSString *key = BenchmarkKey(@"soak");
+            id<IFacade> facade = [Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k]; }];
+            [facade registerProxy:[BenchmarkProxy withName:@"BenchmarkProxy"]];
+            [facade registerMediator:[BenchmarkMediator withName:@"BenchmarkMediator"]];
+            [facade registerCommand:BenchmarkNotification factory:^id<ICommand> { return [BenchmarkCommand command]; }];
+            [Facade removeCore:key];
+        }
+    }
+}
+
+/**
+Print usage to standard error.
+*/
+static void usage(void) {
+    fprintf(stderr,
+            "usage: pmvc-soak [--cores <n>] [--warmup <n>] [--limit <MB>] [--json <path>|-]\n"
+            "  --cores <n>              Cores created and removed, default 1000000\n"
+            "  --warmup <n>             Cores cycled before the baseline, default 100000\n"
+            "  --limit <MB>             footprint growth that fails the run, default 16\n"
+            "  --json <path>|-          write results as JSON to <path>, or to standard output\n");
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        uint64_t cores = 1000000;
+        uint64_t warmup = 100000;
+        double limit = 16;
+        NSString *jsonPath = nil;
+
+        for (int i = 1; i < argc; i++) {
+            NSString *option = @(argv[i]);
+            BOOL hasValue = i + 1 < argc;
+            if ([option isEqualToString:@"--cores"] && hasValue) {
+                cores = (uint64_t)MAX(atoll(argv[++i]), 1);
+            } else if ([option isEqualToString:@"--warmup"] && hasValue) {
+                warmup = (uint64_t)MAX(atoll(argv[++i]), 0);
+            } else if ([option isEqualToString:@"--limit"] && hasValue) {
+                limit = atof(argv[++i]);
+            } else if ([option isEqualToString:@"--json"] && hasValue) {
+                jsonPath = @(argv[++i]);
+            } else {
+                usage();
+                return [option isEqualToString:@"--help"] ? 0 : 2;
+            }
+        }
+
+        // warm up the allocator before taking the baseline
+        cycle(warmup);
+        uint64_t baseline = footprint();
+        uint64_t start = InstrumentationNow();
+        cycle(cores);
+        double elapsed = (double)(InstrumentationNow() - start) / NSEC_PER_SEC;
+        uint64_t current = footprint();
+        uint64_t growth = current > baseline ? current - baseline : 0;
+        BOOL passed = (double)growth < limit * 1024 * 1024;
+
+        FILE *table = [jsonPath isEqualToString:@"-"] ? stderr : stdout;
+        fprintf(table, "%12s %14s %14s %14s %8s\n", "cores", "cores/s", "baseline MB", "growth MB", "result");
+        fprintf(table, "%12llu %14.0f %14.1f %14.1f %8s\n", (unsigned long long)cores, (double)cores / elapsed,
+                (double)baseline / (1024 * 1024), (double)growth / (1024 * 1024), passed ? "pass" : "FAIL");
+
+        if (jsonPath != nil) {
+            NSDictionary *report = @{
+                @"suite": @"puremvc-objectivec-multicore-soak",
+                @"timestamp": @((long long)[[NSDate date] timeIntervalSince1970]),
+                @"host": @{
+                    @"os": [[NSProcessInfo processInfo] operatingSystemVersionString],
+                    @"cpus": @([[NSProcessInfo processInfo] activeProcessorCount])
+                },
+                @"config": @{
+                    @"cores": @(cores),
+                    @"warmup": @(warmup),
+                    @"limit_mb": @(limit),
+                    @"flight_recorder": @(FlightRecorder.isEnabled)
+                },
+                @"results": @{
+                    @"cores_per_sec": @((double)cores / elapsed),
+                    @"baseline_bytes": @(baseline),
+                    @"growth_bytes": @(growth),
+                    @"passed": @(passed)
+                }
+            };
+            NSError *error = nil;
+            NSData *json = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:&error];
+            if ([jsonPath isEqualToString:@"-"]) {
+                fwrite(json.bytes, 1, json.length, stdout);
+                fputc('\n', stdout);
+            } else if (![json writeToFile:jsonPath options:NSDataWritingAtomic error:&error]) {
+                fprintf(stderr, "pmvc-soak: %s\n", error.localizedDescription.UTF8String);
+                return 1;
+            }
+        }
+        if (!passed) return 1;
+    }
+    return 0;
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,233 @@
+//
+//  Stress.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <pthread.h>
+#import <sched.h>
+#import <stdatomic.h>
+#import <time.h>
+#import "PureMVC.h"
+#import "BenchmarkFixtures.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Start and stop signals shared by the threads of one phase.
+typedef struct {
+    atomic_uint ready;
+    atomic_bool go;
+    atomic_bool stop;
+    atomic_uint_fast64_t churnOperations;
+} StressSignals;
+
+/**
+Wait until every thread of the phase is ready and the phase starts.
+
+- parameter signals: the phase's signals
+*/
+static void awaitStart(StressSignals *signals) {
+    atomic_fetch_add(&signals->ready, 1);
+    while (!atomic_load_explicit(&signals->go, memory_order_acquire)) sched_yield();
+}
+
+/**
+Run one phase: `senders` threads send notifications through a Facade
+while `churners` threads register and remove mediators, proxies and
+commands on the same Core.
+
+- parameter senders: the number of sending threads
+- parameter churners: the number of churning threads
+- parameter mediators: the number of mediators registered for the whole phase
+- parameter seconds: how long the phase runs
+- returns: the phase's results, JSON-compatible
+*/
+static NSDictionary<NSString *, id> *runPhase(NSUInteger senders, NSUInteger churners, NSUInteger mediators, double seconds) {
+    NSString *key = BenchmarkKey(@"stress");
+    id<IFacade> facade = [Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k]; }];
+    [facade registerCommand:BenchmarkNotification factory:^id<ICommand> { return [BenchmarkCommand command]; }];
+    for (NSUInteger i = 0; i < mediators; i++) {
+        [facade registerMediator:[BenchmarkMediator withName:[NSString stringWithFormat:@"Mediator%lu", (unsigned long)i]]];
+    }
+
+    StressSignals *signals = calloc(1, sizeof(StressSignals));
+    NSMutableArray<LatencyHistogram *> *histograms = [NSMutableArray arrayWithCapacity:senders];
+    pthread_t *threads = calloc(senders + churners, sizeof(pthread_t));
+
+    for (NSUInteger t = 0; t < senders; t++) {
+        // one histogram per sender, so recording does not contend
+        LatencyHistogram *histogram = [LatencyHistogram histogram];
+        [histograms addObject:histogram];
+        threads[t] = BenchmarkStartThread(^{
+            awaitStart(signals);
+            while (!atomic_load_explicit(&signals->stop, memory_order_relaxed)) {
+                @autoreleasepool {
+                    uint64_t start = InstrumentationNow();
+                    [facade sendNotification:BenchmarkNotification];
+                    [histogram recordValue:InstrumentationNow() - start];
+                }
+            }
+        });
+    }
+
+    for (NSUInteger t = 0; t < churners; t++) {
+        threads[senders + t] = BenchmarkStartThread(^{
+            NSString *proxyName = [NSString stringWithFormat:@"ChurnProxy%lu", (unsigned long)t];
+            NSString *commandName = [NSString stringWithFormat:@"ChurnCommand%lu", (unsigned long)t];
+            uint64_t operations = 0;
+            awaitStart(signals);
+            for (uint64_t i = 0; !atomic_load_explicit(&signals->stop, memory_order_relaxed); i++) {
+                @autoreleasepool {
+                    NSString *mediatorName = [NSString stringWithFormat:@"Churn%lu.%llu", (unsigned long)t, (unsigned long long)i];
+                    [facade registerMediator:[BenchmarkMediator withName:mediatorName]];
+                    [facade removeMediator:mediatorName];
+                    [facade registerProxy:[BenchmarkProxy withName:proxyName]];
+                    [facade removeProxy:proxyName];
+                    [facade registerCommand:commandName factory:^id<ICommand> { return [BenchmarkCommand command]; }];
+                    [facade removeCommand:commandName];
+                }
+                operations += 6;
+            }
+            atomic_fetch_add(&signals->churnOperations, operations);
+        });
+    }
+
+    while (atomic_load(&signals->ready) < senders + churners) sched_yield();
+    uint64_t start = InstrumentationNow();
+    atomic_store_explicit(&signals->go, true, memory_order_release);
+    struct timespec duration = { (time_t)seconds, (long)((seconds - (time_t)seconds) * NSEC_PER_SEC) };
+    while (nanosleep(&duration, &duration) != 0);
+    atomic_store_explicit(&signals->stop, true, memory_order_relaxed);
+    for (NSUInteger t = 0; t < senders + churners; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double elapsed = (double)(InstrumentationNow() - start) / NSEC_PER_SEC;
+    uint64_t churned = atomic_load(&signals->churnOperations);
+    free(threads);
+    free(signals);
+    [Facade removeCore:key];
+
+    LatencyHistogram *latency = [LatencyHistogram histogram];
+    for (LatencyHistogram *histogram in histograms) {
+        [latency addHistogram:histogram];
+    }
+
+    return @{
+        @"senders": @(senders),
+        @"churners": @(churners),
+        @"seconds": @(elapsed),
+        @"sends": @(latency.count),
+        @"sends_per_sec": @((double)latency.count / elapsed),
+        @"churn_ops_per_sec": @((double)churned / elapsed),
+        @"latency_ns": @{
+            @"mean": @(latency.mean),
+            @"p50": @([latency valueAtPercentile:50]),
+            @"p99": @([latency valueAtPercentile:99]),
+            @"p999": @([latency valueAtPercentile:99.9]),
+            @"max": @(latency.max)
+        }
+    };
+}
+
+/**
+Print usage to standard error.
+*/
+static void usage(void) {
+    fprintf(stderr,
+            "usage: pmvc-stress [--threads <n>] [--churners <n>] [--mediators <n>] [--duration <ms>] [--json <path>|-]\n"
+            "  --threads <n>            the most sender threads, default the number of active cores\n"
+            "  --churners <n>           threads registering and removing, default 2\n"
+            "  --mediators <n>          mediators observing every send, default 10\n"
+            "  --duration <ms>          duration of each phase, default 1000\n"
+            "  --json <path>|-          write results as JSON to <path>, or to standard output\n");
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        NSUInteger threads = [[NSProcessInfo processInfo] activeProcessorCount];
+        NSUInteger churners = 2;
+        NSUInteger mediators = 10;
+        double seconds = 1;
+        NSString *jsonPath = nil;
+
+        for (int i = 1; i < argc; i++) {
+            NSString *option = @(argv[i]);
+            BOOL hasValue = i + 1 < argc;
+            if ([option isEqualToString:@"--threads"] && hasValue) {
+                threads = (NSUInteger)MAX(atoi(argv[++i]), 1);
+            } else if ([option isEqualToString:@"--churners"] && hasValue) {
+                churners = (NSUInteger)MAX(atoi(argv[++i]), 0);
+            } else if ([option isEqualToString:@"--mediators"] && hasValue) {
+                mediators = (NSUInteger)MAX(atoi(argv[++i]), 0);
+            } else if ([option isEqualToString:@"--duration"] && hasValue) {
+                seconds = atof(argv[++i]) / 1000.0;
+            } else if ([option isEqualToString:@"--json"] && hasValue) {
+                jsonPath = @(argv[++i]);
+            } else {
+                usage();
+                return [option isEqualToString:@"--help"] ? 0 : 2;
+            }
+        }
+
+        // 1, 2, 4 ... sender threads, ending at the requested count
+        NSMutableArray<NSNumber *> *steps = [NSMutableArray array];
+        for (NSUInteger n = 1; n < threads; n *= 2) [steps addObject:@(n)];
+        [steps addObject:@(threads)];
+
+        FILE *table = [jsonPath isEqualToString:@"-"] ? stderr : stdout;
+        fprintf(table, "%8s %8s %14s %10s %10s %10s %10s %12s %14s\n",
+                "senders", "churners", "sends/s", "scaling", "p50 ns", "p99 ns", "p99.9 ns", "max ns", "churn ops/s");
+
+        NSMutableArray<NSDictionary *> *results = [NSMutableArray array];
+        double baseline = 0;
+        for (NSNumber *step in steps) {
+            NSMutableDictionary *result = [runPhase(step.unsignedIntegerValue, churners, mediators, seconds) mutableCopy];
+            double throughput = [result[@"sends_per_sec"] doubleValue];
+            if (baseline == 0) baseline = throughput;
+            // throughput relative to perfect linear scaling from one sender; a drop flags a scaling cliff
+            double scaling = baseline > 0 ? throughput / (baseline * step.doubleValue) : 0;
+            result[@"scaling"] = @(scaling);
+            [results addObject:result];
+
+            NSDictionary *latency = result[@"latency_ns"];
+            fprintf(table, "%8lu %8lu %14.0f %10.2f %10llu %10llu %10llu %12llu %14.0f\n",
+                    (unsigned long)step.unsignedIntegerValue, (unsigned long)churners, throughput, scaling,
+                    [latency[@"p50"] unsignedLongLongValue], [latency[@"p99"] unsignedLongLongValue],
+                    [latency[@"p999"] unsignedLongLongValue], [latency[@"max"] unsignedLongLongValue],
+                    [result[@"churn_ops_per_sec"] doubleValue]);
+        }
+
+        if (jsonPath != nil) {
+            NSDictionary *report = @{
+                @"suite": @"puremvc-objectivec-multicore-stress",
+                @"timestamp": @((long long)[[NSDate date] timeIntervalSince1970]),
+                @"host": @{
+                    @"os": [[NSProcessInfo processInfo] operatingSystemVersionString],
+                    @"cpus": @([[NSProcessInfo processInfo] activeProcessorCount])
+                },
+                @"config": @{
+                    @"duration_ms": @(seconds * 1000.0),
+                    @"churners": @(churners),
+                    @"mediators": @(mediators),
+                    @"flight_recorder": @(FlightRecorder.isEnabled)
+                },
+                @"results": results
+            };
+            NSError *error = nil;
+            NSData *json = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:&error];
+            if ([jsonPath isEqualToString:@"-"]) {
+                fwrite(json.bytes, 1, json.length, stdout);
+                fputc('\n', stdout);
+            } else if (![json writeToFile:jsonPath options:NSDataWritingAtomic error:&error]) {
+                fprintf(stderr, "pmvc-stress: %s\n", error.localizedDescription.UTF8String);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,598 @@
+//
+//  main.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <sched.h>
+#import "PureMVC.h"
+#import "Benchmark.h"
+#import "BenchmarkFixtures.h"
+#import "AllocationCounter.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+A `notifyObservers:` benchmark with a given number of observers.
+
+- parameter fanout: the number of observers of the notification
+- returns: the benchmark
+*/
+static Benchmark *notifyObserversBenchmark(NSUInteger fanout) {
+    return [Benchmark withName:[NSString stringWithFormat:@"View.notifyObservers fanout=%lu", (unsigned long)fanout] setup:^id (uint64_t iterations) {
+        NSString *key = BenchmarkKey(@"notify");
+        id<IView> view = [View getInstance:key factory:^(NSString *k) { return [View withKey:k]; }];
+        NSMutableArray<BenchmarkReceiver *> *receivers = [NSMutableArray arrayWithCapacity:fanout];
+        for (NSUInteger i = 0; i < fanout; i++) {
+            BenchmarkReceiver *receiver = [[BenchmarkReceiver alloc] init];
+            [receivers addObject:receiver];
+            [view registerObserver:BenchmarkNotification observer:[Observer withNotify:@selector(onNotification:) context:receiver]];
+        }
+        // observers hold their contexts weakly
+        return @[key, view, receivers, [Notification withName:BenchmarkNotification]];
+    } operation:^(NSArray *context, uint64_t iterations) {
+        id<IView> view = context[1];
+        id<INotification> notification = context[3];
+        for (uint64_t i = 0; i < iterations; i++) {
+            [view notifyObservers:notification];
+        }
+    } teardown:^(NSArray *context) {
+        [View removeView:context[0]];
+    }];
+}
+
+/**
+A benchmark of a command that retrieves a proxy and sends a notification
+through its facade, executed by a `Facade.sendNotification:`.
+
+- parameter name: the name of the benchmark
+- parameter factory: creates the command
+- returns: the benchmark
+*/
+static Benchmark *commandSendNotificationBenchmark(NSString *name, id<ICommand> (^factory)(void)) {
+    return [Benchmark withName:name setup:^id (uint64_t iterations) {
+        NSString *key = BenchmarkKey(@"commandSendNotification");
+        id<IFacade> facade = [Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k]; }];
+        [facade registerProxy:[BenchmarkProxy withName:@"BenchmarkProxy"]];
+        [facade registerMediator:[BenchmarkMediator withName:@"BenchmarkMediator"]];
+        [facade registerCommand:BenchmarkSendingNotification factory:factory];
+        return @[key, facade];
+    } operation:^(NSArray *context, uint64_t iterations) {
+        id<IFacade> facade = context[1];
+        for (uint64_t i = 0; i < iterations; i++) {
+            [facade sendNotification:BenchmarkSendingNotification];
+        }
+    } teardown:^(NSArray *context) {
+        [Facade removeCore:context[0]];
+    }];
+}
+
+/**
+Benchmarks of a whole Core, created shared between threads or confined to this one.
+
+- parameter confined: whether the Core is confined
+- returns: the benchmarks
+*/
+static NSArray<Benchmark *> *coreConfinementBenchmarks(BOOL confined) {
+    NSString *mode = confined ? @"confined" : @"shared";
+    id<IFacade> (^create)(NSString *) = ^id<IFacade> (NSString *key) {
+        return [Facade getInstance:key factory:^(NSString *k) { return confined ? [Facade confinedWithKey:k] : [Facade withKey:k]; }];
+    };
+    return @[
+        [Benchmark withName:[NSString stringWithFormat:@"Core.sendNotification %@", mode] setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"sendNotification");
+            id<IFacade> facade = create(key);
+            [facade registerCommand:BenchmarkNotification factory:^id<ICommand> { return [BenchmarkCommand command]; }];
+            for (NSUInteger i = 0; i < 10; i++) {
+                [facade registerMediator:[BenchmarkMediator withName:[NSString stringWithFormat:@"Mediator%lu", (unsigned long)i]]];
+            }
+            return @[key, facade];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            id<IFacade> facade = context[1];
+            for (uint64_t i = 0; i < iterations; i++) {
+                [facade sendNotification:BenchmarkNotification];
+            }
+        } teardown:^(NSArray *context) {
+            [Facade removeCore:context[0]];
+        }],
+
+        [Benchmark withName:[NSString stringWithFormat:@"Core.retrieveProxy %@", mode] setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"coreRetrieveProxy");
+            id<IFacade> facade = create(key);
+            [facade registerProxy:[BenchmarkProxy withName:@"BenchmarkProxy"]];
+            return @[key, facade];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            id<IFacade> facade = context[1];
+            for (uint64_t i = 0; i < iterations; i++) {
+                [facade retrieveProxy:@"BenchmarkProxy"];
+            }
+        } teardown:^(NSArray *context) {
+            [Facade removeCore:context[0]];
+        }],
+
+        [Benchmark withName:[NSString stringWithFormat:@"Core.register+removeMediator %@", mode] setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"coreRegisterMediator");
+            id<IFacade> facade = create(key);
+            return @[key, facade, [BenchmarkMediator withName:@"BenchmarkMediator"]];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            id<IFacade> facade = context[1];
+            BenchmarkMediator *mediator = context[2];
+            for (uint64_t i = 0; i < iterations; i++) {
+                [facade registerMediator:mediator];
+                [facade removeMediator:@"BenchmarkMediator"];
+            }
+        } teardown:^(NSArray *context) {
+            [Facade removeCore:context[0]];
+        }]
+    ];
+}
+
+/**
+A `Facade.getInstance:factory:` benchmark of 64 existing Cores looked up
+from a number of threads, each thread also creating and removing a Core
+every 1000 lookups to exercise the registry's locks.
+
+- parameter threads: the number of looking up threads
+- returns: the benchmark
+*/
+static Benchmark *getInstanceContentionBenchmark(NSUInteger threads) {
+    return [Benchmark withName:[NSString stringWithFormat:@"Facade.getInstance threads=%lu", (unsigned long)threads] setup:^id (uint64_t iterations) {
+        NSMutableArray<NSString *> *keys = [NSMutableArray arrayWithCapacity:64];
+        for (NSUInteger i = 0; i < 64; i++) {
+            NSString *key = BenchmarkKey(@"getInstanceContention");
+            [Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k]; }];
+            [keys addObject:key];
+        }
+        return keys;
+    } operation:^(NSArray<NSString *> *keys, uint64_t iterations) {
+        uint64_t share = (iterations + threads - 1) / threads;
+        pthread_t workers[threads];
+        for (NSUInteger t = 0; t < threads; t++) {
+            NSString *churn = BenchmarkKey(@"getInstanceChurn");
+            workers[t] = BenchmarkStartThread(^{
+                for (uint64_t i = 0; i < share; i++) {
+                    [Facade getInstance:keys[i % 64] factory:^(NSString *k) { return [Facade withKey:k]; }];
+                    if (i % 1000 == 999) {
+                        [Facade getInstance:churn factory:^(NSString *k) { return [Facade withKey:k]; }];
+                        [Facade removeCore:churn];
+                    }
+                }
+            });
+        }
+        for (NSUInteger t = 0; t < threads; t++) pthread_join(workers[t], NULL);
+    } teardown:^(NSArray<NSString *> *keys) {
+        for (NSString *key in keys) [Facade removeCore:key];
+    }];
+}
+
+/**
+Register a session's startup set: 50 commands, 50 proxy factories and 10 mediators.
+
+- parameter facade: the facade of the session's Core
+*/
+static void registerStartup(id<IFacade> facade) {
+    for (NSUInteger i = 0; i < 50; i++) {
+        NSString *name = [NSString stringWithFormat:@"BenchmarkProxy%lu", (unsigned long)i];
+        [facade registerCommand:[NSString stringWithFormat:@"BenchmarkNotification%lu", (unsigned long)i] factory:^id<ICommand> { return [BenchmarkCommand command]; }];
+        [facade registerProxyFactory:^id<IProxy> { return [BenchmarkProxy withName:name]; } name:name];
+    }
+    for (NSUInteger i = 0; i < 10; i++) {
+        [facade registerMediator:[BenchmarkMediator withName:[NSString stringWithFormat:@"Mediator%lu", (unsigned long)i]]];
+    }
+}
+
+/**
+Benchmarks of building a Core per session by registering its startup set,
+and by instantiating a `CoreTemplate` of the same set.
+
+- returns: the benchmarks
+*/
+static NSArray<Benchmark *> *coreTemplateBenchmarks(void) {
+    return @[
+        [Benchmark withName:@"Startup.register" setup:^id (uint64_t iterations) {
+            return BenchmarkKey(@"registerStartup");
+        } operation:^(NSString *key, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                registerStartup([Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k]; }]);
+                [Facade removeCore:key];
+            }
+        } teardown:nil],
+
+        [Benchmark withName:@"Startup.template" setup:^id (uint64_t iterations) {
+            NSString *prototype = BenchmarkKey(@"templatePrototype");
+            registerStartup([Facade getInstance:prototype factory:^(NSString *k) { return [Facade withKey:k]; }]);
+            return @[prototype, [CoreTemplate withKey:prototype], BenchmarkKey(@"templateStartup")];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            CoreTemplate *template = context[1];
+            NSString *key = context[2];
+            for (uint64_t i = 0; i < iterations; i++) {
+                [template instantiateWithKey:key];
+                [Facade removeCore:key];
+            }
+        } teardown:^(NSArray *context) {
+            [Facade removeCore:context[0]];
+        }]
+    ];
+}
+
+/**
+Wait for a counter's notifications, exiting if they do not arrive.
+
+- parameter counter: the counter
+- parameter name: the name of the waiting benchmark
+*/
+static void awaitCounter(BenchmarkCounter *counter, NSString *name) {
+    if ([counter await]) return;
+    fprintf(stderr, "pmvc-bench: %s timed out\n", name.UTF8String);
+    exit(1);
+}
+
+/**
+A `Pipe` throughput benchmark: writers write into one Core's pipe,
+retrying while it is full, until its `View` has delivered every notification.
+
+- parameter writers: the number of writing threads
+- returns: the benchmark
+*/
+static Benchmark *pipeThroughputBenchmark(NSUInteger writers) {
+    NSString *name = [NSString stringWithFormat:@"Pipe.write %lu->1", (unsigned long)writers];
+    return [Benchmark withName:name setup:^id (uint64_t iterations) {
+        NSString *key = BenchmarkKey(@"pipe");
+        BenchmarkCounter *counter = [[BenchmarkCounter alloc] init];
+        id<IView> view = [View getInstance:key factory:^(NSString *k) { return [View withKey:k]; }];
+        [view registerObserver:BenchmarkNotification observer:[Observer withNotify:@selector(onNotification:) context:counter]];
+        Pipe *pipe = [Pipe getInstance:key factory:^(NSString *k) { return [Pipe withKey:k]; }];
+        return @[key, pipe, counter, [Notification withName:BenchmarkNotification]];
+    } operation:^(NSArray *context, uint64_t iterations) {
+        Pipe *pipe = context[1];
+        BenchmarkCounter *counter = context[2];
+        id<INotification> notification = context[3];
+        uint64_t share = (iterations + writers - 1) / writers;
+        [counter expect:share * writers];
+        pthread_t threads[writers];
+        for (NSUInteger t = 0; t < writers; t++) {
+            threads[t] = BenchmarkStartThread(^{
+                for (uint64_t i = 0; i < share; i++) {
+                    while (![pipe write:notification]) sched_yield();
+                }
+            });
+        }
+        for (NSUInteger t = 0; t < writers; t++) pthread_join(threads[t], NULL);
+        awaitCounter(counter, name);
+    } teardown:^(NSArray *context) {
+        [Facade removeCore:context[0]];
+    }];
+}
+
+/**
+A round trip between two Cores through their pipes: a notification
+written to one Core, answered by its observer into the other.
+
+- returns: the benchmark
+*/
+static Benchmark *pipeRoundTripBenchmark(void) {
+    return [Benchmark withName:@"Pipe.write round trip" setup:^id (uint64_t iterations) {
+        NSString *senderKey = BenchmarkKey(@"pipeSender");
+        NSString *receiverKey = BenchmarkKey(@"pipeReceiver");
+        BenchmarkCounter *counter = [[BenchmarkCounter alloc] init];
+        BenchmarkReplier *replier = [[BenchmarkReplier alloc] init];
+        replier.replyKey = senderKey;
+        id<IView> sender = [View getInstance:senderKey factory:^(NSString *k) { return [View withKey:k]; }];
+        id<IView> receiver = [View getInstance:receiverKey factory:^(NSString *k) { return [View withKey:k]; }];
+        [sender registerObserver:BenchmarkReplyNotification observer:[Observer withNotify:@selector(onNotification:) context:counter]];
+        [receiver registerObserver:BenchmarkNotification observer:[Observer withNotify:@selector(onNotification:) context:replier]];
+        [Pipe getInstance:senderKey factory:^(NSString *k) { return [Pipe withKey:k]; }];
+        [Pipe getInstance:receiverKey factory:^(NSString *k) { return [Pipe withKey:k]; }];
+        return @[senderKey, receiverKey, counter, replier, [Notification withName:BenchmarkNotification]];
+    } operation:^(NSArray *context, uint64_t iterations) {
+        NSString *receiverKey = context[1];
+        BenchmarkCounter *counter = context[2];
+        id<INotification> notification = context[4];
+        for (uint64_t i = 0; i < iterations; i++) {
+            [counter expect:1];
+            [Pipe write:notification toCore:receiverKey];
+            awaitCounter(counter, @"Pipe.write round trip");
+        }
+    } teardown:^(NSArray *context) {
+        [Facade removeCore:context[0]];
+        [Facade removeCore:context[1]];
+    }];
+}
+
+/**
+Benchmarks of starting a Model whose Proxy parses its data on registration,
+and of starting it from a snapshot of that data.
+
+- returns: the benchmarks
+*/
+static NSArray<Benchmark *> *modelStartBenchmarks(void) {
+    return @[
+        [Benchmark withName:@"Model.start cold" setup:^id (uint64_t iterations) {
+            return BenchmarkKey(@"coldStart");
+        } operation:^(NSString *key, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                id<IModel> model = [Model getInstance:key factory:^(NSString *k) { return [Model withKey:k]; }];
+                [model registerProxy:[BenchmarkSnapshotProxy proxy]];
+                [Model removeModel:key];
+            }
+        } teardown:nil],
+
+        [Benchmark withName:@"Model.start snapshot" setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"snapshotStart");
+            NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[key stringByAppendingPathExtension:@"pmvs"]]];
+            id<IModel> model = [Model getInstance:key factory:^(NSString *k) { return [Model withKey:k]; }];
+            [model registerProxy:[BenchmarkSnapshotProxy proxy]];
+            [(Model *)model writeSnapshotToURL:url error:NULL];
+            [Model removeModel:key];
+            return @[key, url];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            NSString *key = context[0];
+            for (uint64_t i = 0; i < iterations; i++) {
+                id<IModel> model = [Model getInstance:key factory:^(NSString *k) { return [Model withKey:k]; }];
+                [(Model *)model loadSnapshotFromURL:context[1] error:NULL];
+                [model registerProxy:[BenchmarkSnapshotProxy proxy]];
+                [Model removeModel:key];
+            }
+        } teardown:^(NSArray *context) {
+            [[NSFileManager defaultManager] removeItemAtURL:context[1] error:NULL];
+        }]
+    ];
+}
+
+/**
+The `NotificationCodec` encoding of a notification with a 64 byte body,
+against the same content encoded with `NSKeyedArchiver` and as JSON.
+
+- returns: the benchmarks
+*/
+static NSArray<Benchmark *> *codecBenchmarks(void) {
+    id<INotification> notification = [Notification withName:BenchmarkNotification body:[NSMutableData dataWithLength:64] type:@"Type"];
+    NotificationCodec *codec = [NotificationCodec withNames:@[BenchmarkNotification, @"Type"] bodyCodec:nil];
+    NSDictionary *content = @{@"name": notification.name, @"type": notification.type, @"body": notification.body};
+    NSDictionary *json = @{@"name": notification.name, @"type": notification.type, @"body": [notification.body base64EncodedStringWithOptions:0]};
+    NSSet *classes = [NSSet setWithObjects:[NSDictionary class], [NSString class], [NSData class], nil];
+    return @[
+        [Benchmark withName:@"NotificationCodec.encode" setup:^id (uint64_t iterations) {
+            return [NSMutableData dataWithCapacity:128];
+        } operation:^(NSMutableData *buffer, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                buffer.length = 0;
+                [codec encode:notification into:buffer];
+            }
+        } teardown:nil],
+
+        [Benchmark withName:@"NotificationCodec.decode" setup:^id (uint64_t iterations) {
+            return [codec encode:notification];
+        } operation:^(NSData *encoded, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                [codec decode:encoded error:NULL];
+            }
+        } teardown:nil],
+
+        [Benchmark withName:@"NSKeyedArchiver.encode" operation:^(uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                [NSKeyedArchiver archivedDataWithRootObject:content requiringSecureCoding:YES error:NULL];
+            }
+        }],
+
+        [Benchmark withName:@"NSKeyedUnarchiver.decode" setup:^id (uint64_t iterations) {
+            return [NSKeyedArchiver archivedDataWithRootObject:content requiringSecureCoding:YES error:NULL];
+        } operation:^(NSData *encoded, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                NSDictionary *dictionary = [NSKeyedUnarchiver unarchivedObjectOfClasses:classes fromData:encoded error:NULL];
+                [Notification withName:dictionary[@"name"] body:dictionary[@"body"] type:dictionary[@"type"]];
+            }
+        } teardown:nil],
+
+        [Benchmark withName:@"NSJSONSerialization.encode" operation:^(uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                NSDictionary *dictionary = @{@"name": notification.name, @"type": notification.type, @"body": [notification.body base64EncodedStringWithOptions:0]};
+                [NSJSONSerialization dataWithJSONObject:dictionary options:0 error:NULL];
+            }
+        }],
+
+        [Benchmark withName:@"NSJSONSerialization.decode" setup:^id (uint64_t iterations) {
+            return [NSJSONSerialization dataWithJSONObject:json options:0 error:NULL];
+        } operation:^(NSData *encoded, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                NSDictionary *dictionary = [NSJSONSerialization JSONObjectWithData:encoded options:0 error:NULL];
+                [Notification withName:dictionary[@"name"] body:[[NSData alloc] initWithBase64EncodedString:dictionary[@"body"] options:0] type:dictionary[@"type"]];
+            }
+        } teardown:nil]
+    ];
+}
+
+/**
+The micro-benchmarks of the core framework operations.
+
+- returns: the benchmarks, in reporting order
+*/
+static NSArray<Benchmark *> *coreBenchmarks(void) {
+    NSMutableArray<Benchmark *> *benchmarks = [@[
+        [Benchmark withName:@"View.registerMediator" setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"registerMediator");
+            id<IView> view = [View getInstance:key factory:^(NSString *k) { return [View withKey:k]; }];
+            NSMutableArray<BenchmarkMediator *> *mediators = [NSMutableArray arrayWithCapacity:(NSUInteger)iterations];
+            for (uint64_t i = 0; i < iterations; i++) {
+                [mediators addObject:[BenchmarkMediator withName:[NSString stringWithFormat:@"Mediator%llu", (unsigned long long)i]]];
+            }
+            return @[key, view, mediators];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            id<IView> view = context[1];
+            for (BenchmarkMediator *mediator in context[2]) {
+                [view registerMediator:mediator];
+            }
+        } teardown:^(NSArray *context) {
+            [View removeView:context[0]];
+        }],
+
+        notifyObserversBenchmark(1),
+        notifyObserversBenchmark(10),
+        notifyObserversBenchmark(1000),
+
+        [Benchmark withName:@"Controller.executeCommand" setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"executeCommand");
+            id<IController> controller = [Controller getInstance:key factory:^(NSString *k) { return [Controller withKey:k]; }];
+            [controller registerCommand:BenchmarkNotification factory:^id<ICommand> { return [BenchmarkCommand command]; }];
+            return @[key, controller, [Notification withName:BenchmarkNotification]];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            id<IController> controller = context[1];
+            id<INotification> notification = context[2];
+            for (uint64_t i = 0; i < iterations; i++) {
+                [controller executeCommand:notification];
+            }
+        } teardown:^(NSArray *context) {
+            [Controller removeController:context[0]];
+            [View removeView:context[0]];
+        }],
+
+        commandSendNotificationBenchmark(@"Command.sendNotification", ^id<ICommand> { return [BenchmarkSendingCommand command]; }),
+        commandSendNotificationBenchmark(@"Command.sendNotification uncached", ^id<ICommand> { return [BenchmarkLookupCommand command]; }),
+
+        [Benchmark withName:@"Model.retrieveProxy" setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"retrieveProxy");
+            id<IModel> model = [Model getInstance:key factory:^(NSString *k) { return [Model withKey:k]; }];
+            [model registerProxy:[BenchmarkProxy withName:@"BenchmarkProxy"]];
+            return @[key, model];
+        } operation:^(NSArray *context, uint64_t iterations) {
+            id<IModel> model = context[1];
+            for (uint64_t i = 0; i < iterations; i++) {
+                [model retrieveProxy:@"BenchmarkProxy"];
+            }
+        } teardown:^(NSArray *context) {
+            [Model removeModel:context[0]];
+        }],
+
+        [Benchmark withName:@"MacroCommand.execute subcommands=3" setup:^id (uint64_t iterations) {
+            return [Notification withName:BenchmarkNotification];
+        } operation:^(id<INotification> notification, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                [[BenchmarkMacroCommand command] execute:notification];
+            }
+        } teardown:nil],
+
+        [Benchmark withName:@"Facade.getInstance" setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"getInstance");
+            [Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k]; }];
+            return key;
+        } operation:^(NSString *key, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                [Facade getInstance:key factory:^(NSString *k) { return [Facade withKey:k]; }];
+            }
+        } teardown:^(NSString *key) {
+            [Facade removeCore:key];
+        }],
+
+        getInstanceContentionBenchmark(1),
+        getInstanceContentionBenchmark(4),
+        getInstanceContentionBenchmark(16),
+
+        [Benchmark withName:@"View.getInstance" setup:^id (uint64_t iterations) {
+            NSString *key = BenchmarkKey(@"viewGetInstance");
+            [View getInstance:key factory:^(NSString *k) { return [View withKey:k]; }];
+            return key;
+        } operation:^(NSString *key, uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                [View getInstance:key factory:^(NSString *k) { return [View withKey:k]; }];
+            }
+        } teardown:^(NSString *key) {
+            [View removeView:key];
+        }]
+    ] mutableCopy];
+    [benchmarks addObjectsFromArray:modelStartBenchmarks()];
+    [benchmarks addObjectsFromArray:coreTemplateBenchmarks()];
+    [benchmarks addObjectsFromArray:@[pipeThroughputBenchmark(1), pipeThroughputBenchmark(4), pipeRoundTripBenchmark()]];
+    [benchmarks addObjectsFromArray:coreConfinementBenchmarks(NO)];
+    [benchmarks addObjectsFromArray:coreConfinementBenchmarks(YES)];
+    [benchmarks addObjectsFromArray:codecBenchmarks()];
+    return benchmarks;
+}
+
+/**
+Print usage to standard error.
+*/
+static void usage(void) {
+    fprintf(stderr,
+            "usage: pmvc-bench [--filter <text>] [--time <ms>] [--samples <n>] [--json <path>|-] [--no-flight-recorder]\n"
+            "  --filter <text>          run only benchmarks whose name contains <text>\n"
+            "  --time <ms>              minimum duration of each sample, default 100\n"
+            "  --samples <n>            samples per benchmark, default 5\n"
+            "  --json <path>|-          write results as JSON to <path>, or to standard output\n"
+            "  --no-flight-recorder     measure with FlightRecorder disabled\n");
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        NSString *filter = nil;
+        NSString *jsonPath = nil;
+        double seconds = 0.1;
+        NSUInteger samples = 5;
+
+        for (int i = 1; i < argc; i++) {
+            NSString *option = @(argv[i]);
+            BOOL hasValue = i + 1 < argc;
+            if ([option isEqualToString:@"--filter"] && hasValue) {
+                filter = @(argv[++i]);
+            } else if ([option isEqualToString:@"--time"] && hasValue) {
+                seconds = atof(argv[++i]) / 1000.0;
+            } else if ([option isEqualToString:@"--samples"] && hasValue) {
+                samples = (NSUInteger)MAX(atoi(argv[++i]), 1);
+            } else if ([option isEqualToString:@"--json"] && hasValue) {
+                jsonPath = @(argv[++i]);
+            } else if ([option isEqualToString:@"--no-flight-recorder"]) {
+                FlightRecorder.enabled = NO;
+            } else {
+                usage();
+                return [option isEqualToString:@"--help"] ? 0 : 2;
+            }
+        }
+
+        // the table goes to standard error when the JSON goes to standard output
+        FILE *table = [jsonPath isEqualToString:@"-"] ? stderr : stdout;
+        fprintf(table, "%-40s %14s %12s %14s\n", "benchmark", "ns/op", "allocs/op", "iterations");
+
+        NSMutableArray<NSDictionary *> *results = [NSMutableArray array];
+        for (Benchmark *benchmark in coreBenchmarks()) {
+            if (filter != nil && [benchmark.name rangeOfString:filter].location == NSNotFound) continue;
+            BenchmarkResult *result = [benchmark runWithTargetTime:seconds samples:samples];
+            [results addObject:[result dictionary]];
+
+            char allocs[32] = "n/a";
+            if (result.allocsPerOp >= 0) snprintf(allocs, sizeof(allocs), "%.2f", result.allocsPerOp);
+            fprintf(table, "%-40s %14.1f %12s %14llu\n", result.name.UTF8String, result.nsPerOp, allocs, (unsigned long long)result.iterations);
+        }
+
+        if (jsonPath != nil) {
+            NSDictionary *report = @{
+                @"suite": @"puremvc-objectivec-multicore",
+                @"timestamp": @((long long)[[NSDate date] timeIntervalSince1970]),
+                @"host": @{
+                    @"os": [[NSProcessInfo processInfo] operatingSystemVersionString],
+                    @"cpus": @([[NSProcessInfo processInfo] activeProcessorCount])
+                },
+                @"config": @{
+                    @"sample_ms": @(seconds * 1000.0),
+                    @"samples": @(samples),
+                    @"flight_recorder": @(FlightRecorder.isEnabled),
+                    @"allocation_counting": @(AllocationCountingAvailable())
+                },
+                @"results": results
+            };
+            NSError *error = nil;
+            NSData *json = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:&error];
+            if ([jsonPath isEqualToString:@"-"]) {
+                fwrite(json.bytes, 1, json.length, stdout);
+                fputc('\n', stdout);
+            } else if (![json writeToFile:jsonPath options:NSDataWritingAtomic error:&error]) {
+                fprintf(stderr, "pmvc-bench: %s\n", error.localizedDescription.UTF8String);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,139 @@
+//
+//  Bus.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import "Bus.h"
+#import "Pipe.h"
+#import "VersionedReference.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Topic index: the pipes of the subscribed Cores, by topic.
+static VersionedReference<NSDictionary<NSString *, NSArray<Pipe *> *> *> *topicIndex = nil;
+
+/// Initializes the global topic index.
+__attribute__((constructor()))
+static void initialize(void) {
+    topicIndex = [VersionedReference withValue:@{}];
+}
+
+/**
+A process-wide, topic-routed broadcast bus between Cores.
+
+The topic index is an immutable dictionary published through a
+`VersionedReference`: publishing loads it without a lock, while
+subscription changes, which are rare, copy it under the writer lock.
+The index holds each subscriber's `Pipe` rather than its key, so a
+publish does no per-Core lookup.
+
+`@see Pipe`
+*/
+@implementation Bus
+
+/**
+Subscribe a Core to a topic.
+
+- parameter key: multitonKey of the Core
+- parameter topic: the topic to subscribe to
+*/
++ (void)subscribe:(NSString *)key topic:(NSString *)topic {
+    Pipe *pipe = [Pipe getInstance:key factory:^(NSString *multitonKey) { return [Pipe withKey:multitonKey]; }];
+    [topicIndex update:^NSDictionary *(NSDictionary<NSString *, NSArray<Pipe *> *> *index) {
+        NSArray<Pipe *> *pipes = index[topic] ?: @[];
+        for (Pipe *subscriber in pipes) {
+            if ([subscriber.multitonKey isEqualToString:key]) return index;
+        }
+        NSMutableDictionary *copy = [index mutableCopy];
+        copy[topic] = [pipes arrayByAddingObject:pipe];
+        return [copy copy];
+    }];
+}
+
+/**
+Unsubscribe a Core from a topic.
+
+- parameter key: multitonKey of the Core
+- parameter topic: the topic to unsubscribe from
+*/
++ (void)unsubscribe:(NSString *)key topic:(NSString *)topic {
+    [topicIndex update:^NSDictionary *(NSDictionary<NSString *, NSArray<Pipe *> *> *index) {
+        NSArray<Pipe *> *pipes = [Bus pipes:index[topic] excludingKey:key];
+        if (pipes == nil) return index;
+        NSMutableDictionary *copy = [index mutableCopy];
+        copy[topic] = pipes.count > 0 ? pipes : nil;
+        return [copy copy];
+    }];
+}
+
+/**
+Unsubscribe a Core from every topic.
+
+- parameter key: multitonKey of the Core
+*/
++ (void)unsubscribeCore:(NSString *)key {
+    [topicIndex update:^NSDictionary *(NSDictionary<NSString *, NSArray<Pipe *> *> *index) {
+        NSMutableDictionary *copy = nil;
+        for (NSString *topic in index) {
+            NSArray<Pipe *> *pipes = [Bus pipes:index[topic] excludingKey:key];
+            if (pipes == nil) continue;
+            if (copy == nil) copy = [index mutableCopy];
+            copy[topic] = pipes.count > 0 ? pipes : nil;
+        }
+        return copy != nil ? [copy copy] : index;
+    }];
+}
+
+/**
+Remove the pipe of a Core from a list of subscribers.
+
+- parameter pipes: the subscribers of a topic
+- parameter key: multitonKey of the Core to remove
+- returns: the remaining subscribers, or nil if the Core was not among them
+*/
++ (nullable NSArray<Pipe *> *)pipes:(nullable NSArray<Pipe *> *)pipes excludingKey:(NSString *)key {
+    NSIndexSet *indexes = [pipes indexesOfObjectsPassingTest:^BOOL(Pipe *pipe, NSUInteger index, BOOL *stop) {
+        return [pipe.multitonKey isEqualToString:key];
+    }];
+    if (indexes.count == 0) return nil;
+    NSMutableArray<Pipe *> *remaining = [pipes mutableCopy];
+    [remaining removeObjectsAtIndexes:indexes];
+    return remaining;
+}
+
+/**
+Check whether a Core is subscribed to a topic.
+
+- parameter key: multitonKey of the Core
+- parameter topic: the topic
+- returns: YES if the Core is subscribed to the topic
+*/
++ (BOOL)isSubscribed:(NSString *)key topic:(NSString *)topic {
+    for (Pipe *pipe in [topicIndex load][topic]) {
+        if ([pipe.multitonKey isEqualToString:key]) return YES;
+    }
+    return NO;
+}
+
+/**
+Deliver a notification to every Core subscribed to a topic.
+
+- parameter notification: the notification, shared by all subscribers
+- parameter topic: the topic to publish to
+- returns: the number of Cores the notification was written to
+*/
++ (NSUInteger)publish:(id<INotification>)notification topic:(NSString *)topic {
+    NSUInteger delivered = 0;
+    for (Pipe *pipe in [topicIndex load][topic]) {
+        if ([pipe write:notification]) delivered++;
+    }
+    return delivered;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,86 @@
+//
+//  Confinement.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <pthread.h>
+#import "Confinement.h"
+#import "MultitonRegistry.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Confinements keyed by multiton key.
+static MultitonRegistry<Confinement *> *confinements = nil;
+
+/// Initializes the confinement registry.
+__attribute__((constructor()))
+static void initialize(void) {
+    confinements = [MultitonRegistry registry];
+}
+
+/**
+The confinement of a Core to the thread that created it.
+*/
+@implementation Confinement {
+    /// The thread the Core is confined to.
+    pthread_t _owner;
+}
+
+/**
+Confine a Core to the calling thread.
+
+- parameter key: the multiton key of the Core
+- returns: the Core's confinement, the existing one if it is already confined
+*/
++ (Confinement *)confineCore:(NSString *)key {
+    return [confinements objectForKey:key factory:^(NSString *k) { return [[Confinement alloc] initWithKey:k]; }];
+}
+
+/**
+The confinement of a Core, if it is confined.
+
+- parameter key: the multiton key of the Core
+- returns: the Core's confinement, or nil
+*/
++ (nullable Confinement *)confinementForKey:(NSString *)key {
+    return [confinements objectForKey:key];
+}
+
+/**
+Release a Core from confinement.
+
+- parameter key: the multiton key of the Core
+*/
++ (void)removeConfinement:(NSString *)key {
+    [confinements removeObjectForKey:key];
+}
+
+/**
+Constructor, confining to the calling thread.
+
+- parameter key: the multiton key of the Core
+- returns: the confinement
+*/
+- (instancetype)initWithKey:(NSString *)key {
+    if (self = [super init]) {
+        _multitonKey = [key copy];
+        _owner = pthread_self();
+    }
+    return self;
+}
+
+- (BOOL)isOwnerThread {
+    return pthread_equal(pthread_self(), _owner) != 0;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@ key=%@>", NSStringFromClass([self class]), self.multitonKey];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
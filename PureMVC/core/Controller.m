@@ -7,10 +7,17 @@
 //
 
 #import <Foundation/Foundation.h>
+#import <objc/runtime.h>
 #import "Controller.h"
 #import "ICommand.h"
 #import "Observer.h"
 #import "View.h"
+#import "MultitonRegistry.h"
+#import "Instrumentation.h"
+#import "Tracer.h"
+#import "MemoryAccount.h"
+#import "MapLock.h"
+#import "Probes.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -22,21 +29,27 @@ NS_ASSUME_NONNULL_BEGIN
 /// Mapping of Notification names to factories that instanties and returns `ICommand` Class instances
 @property (nonatomic, strong) NSMutableDictionary<NSString *, id<ICommand> (^)(void)> *commandMap;
 
-/// Concurrent queue for commandMap
-@property (nonatomic, strong) dispatch_queue_t commandMapQueue;
+/// Lock for commandMap
+@property (nonatomic, strong) id<IMapLock> commandMapLock;
 
 /// Local reference to View
 @property (nonatomic, strong, nullable) id<IView> view;
 
+/// Memory attributed to this Core, created on first use.
+@property (nonatomic, strong, readonly) MemoryAccount *memoryAccount;
+
+/// Storage of `memoryAccount`, nil until first use.
+@property (atomic, strong, nullable) MemoryAccount *account;
+
 @end
 
 // The Multiton Controller instanceMap.
-static NSMutableDictionary<NSString *, id<IController>> *instanceMap = nil;
+static MultitonRegistry<id<IController>> *instanceMap = nil;
 
 /// Initializes the global `instanceMap` once per process.
 __attribute__((constructor()))
 static void initialize(void) {
-    instanceMap = [NSMutableDictionary dictionary];
+    instanceMap = [MultitonRegistry registry];
 }
 
 /**
@@ -78,24 +91,19 @@ registrations.
 - returns: the Multiton instance
 */
 + (id<IController>)getInstance:(NSString *)key factory:(id<IController> (^)(NSString *key))factory {
-    @synchronized (instanceMap) {
-        // The Multiton Controller instanceMap.
-        if (instanceMap[key] == nil) {
-            instanceMap[key] = factory(key);
-        }
-        return instanceMap[key];
-    }
+    return [instanceMap objectForKey:key factory:factory];
 }
 
 /**
  Remove an IController instance
 
+ Every `ICommand` mapping of a `Controller` is removed with it.
+
  - parameter key: of IController instance to remove
  */
 + (void)removeController:(NSString *)key {
-    @synchronized (instanceMap) {
-        [instanceMap removeObjectForKey:key];
-    }
+    id<IController> controller = [instanceMap removeObjectForKey:key];
+    if ([(id)controller isKindOfClass:[Controller class]]) [(Controller *)controller removeAllCommands];
 }
 
 /**
@@ -122,7 +130,7 @@ passing the unique key for this instance
 @throws Error if instance for this Multiton key has already been constructed
 */
 - (instancetype)initWithKey:(NSString *)key {
-    if (instanceMap[key] != nil) {
+    if ([instanceMap objectForKey:key] != nil) {
         // Message constant
         [NSException raise:@"ControllerAlreadyExistsException" format:@"A Controller instance already exists for key '%@'.", key];
     }
@@ -130,12 +138,73 @@ passing the unique key for this instance
         _multitonKey = [key copy];
         [instanceMap setObject:self forKey:key];
         _commandMap = [NSMutableDictionary dictionary];
-        _commandMapQueue = dispatch_queue_create("org.puremvc.controller.proxyMapQueue", DISPATCH_QUEUE_CONCURRENT);
+        _commandMapLock = [MapLock lockForCore:key label:@"org.puremvc.controller.commandMapQueue"];
+        // Memory attributed to this Core, created now only while MemoryAccount is enabled
+        if (MemoryAccountingActive()) [self memoryAccount];
         [self initializeController];
     }
     return self;
 }
 
+/**
+Constructor seeding the command map.
+
+The factories are shared with the caller rather than registered
+one at a time, and a single `Observer` is registered with the
+`View` for every notification name in one step.
+
+- parameter key: multitonKey
+- parameter commands: `ICommand` factories keyed by notification name
+
+@throws Error if instance for this Multiton key has already been constructed
+*/
+- (instancetype)initWithKey:(NSString *)key commands:(NSDictionary<NSString *, id<ICommand> (^)(void)> *)commands {
+    if (self = [self initWithKey:key]) {
+        _commandMap = [commands mutableCopy];
+        id<IObserver> observer = [Observer withNotify:@selector(executeCommand:) context:self];
+        if ([(id)self.view isKindOfClass:[View class]]) {
+            [(View *)self.view registerObserver:observer notificationNames:[commands allKeys]];
+        } else {
+            for (NSString *notificationName in commands) {
+                [self.view registerObserver:notificationName observer:observer];
+            }
+        }
+        // accounted per mapping, as removeCommand: releases them
+        if (MemoryAccountingActive()) {
+            for (NSUInteger i = 0; i < commands.count; i++) {
+                [self.memoryAccount recordAllocation:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+                [self.memoryAccount recordAllocation:MemoryCategoryObserver bytes:MemoryAccountObserverSize()];
+            }
+        }
+    }
+    return self;
+}
+
+/**
+The `MemoryAccount` of this Core, created on first use so that Cores
+never accounted for do not register one.
+
+- returns: the account shared with the Core's other actors
+*/
+- (MemoryAccount *)memoryAccount {
+    MemoryAccount *account = self.account;
+    if (account == nil) self.account = account = [MemoryAccount getInstance:self.multitonKey];
+    return account;
+}
+
+/**
+A snapshot of the `ICommand` factories, keyed by notification name.
+
+- returns: the registered `ICommand` factories
+*/
+- (NSDictionary<NSString *, id<ICommand> (^)(void)> *)commands {
+    __block NSDictionary<NSString *, id<ICommand> (^)(void)> *commands = nil;
+    [self.commandMapLock read:^{
+        commands = [self.commandMap copy];
+    }];
+    return commands;
+}
+
 /**
 Initialize the Multiton `Controller` instance.
 
@@ -170,13 +239,17 @@ first time an ICommand has been regisered for this Notification name.
 - parameter factory: reference that returns `ICommand`
 */
 - (void)registerCommand:(NSString *)notificationName factory:(id<ICommand> (^)(void))factory {
-    dispatch_barrier_sync(self.commandMapQueue, ^{
+    [self.commandMapLock write:^{
         if (self.commandMap[notificationName] == nil) { // weak reference to Controller (self) to avoid reference cycle with View and Observer
             id<IObserver> observer = [Observer withNotify:@selector(executeCommand:) context: self];
             [self.view registerObserver:notificationName observer:observer];
+            if (MemoryAccountingActive()) {
+                [self.memoryAccount recordAllocation:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+                [self.memoryAccount recordAllocation:MemoryCategoryObserver bytes:MemoryAccountObserverSize()];
+            }
         }
         [self.commandMap setObject:factory forKey:notificationName];
-    });
+    }];
 }
 
 /**
@@ -186,14 +259,39 @@ to handle a the given `INotification`, then it is executed.
 - parameter notification: an `INotification`
 */
 - (void)executeCommand:(id<INotification>)notification {
+#if PUREMVC_INSTRUMENTATION
+    unsigned flags = InstrumentationActiveFlags();
+    BOOL timed = (flags & (InstrumentationFlagHistograms | InstrumentationFlagWatchdog)) != 0;
+    uint64_t start = timed ? InstrumentationNow() : 0;
+#endif
     __block id<ICommand> (^factory)(void) = nil;
-    dispatch_sync(self.commandMapQueue, ^{
+    [self.commandMapLock read:^{
         factory = self.commandMap[notification.name];
-    });
+    }];
     if (factory == nil) return;
     id<ICommand> command = factory();
-    // [command initializeNotifier:self.multitonKey];
+    [command initializeNotifier:self.multitonKey];
+#if PUREMVC_INSTRUMENTATION
+    uint64_t span = (flags & InstrumentationFlagTrace) != 0 ? [Tracer beginSpan:TraceCategoryCommand name:[(id)command class] core:self.multitonKey] : 0;
+    // SubCommands are accounted to this Core through the current account
+    MemoryAccount *previousAccount = nil;
+    if ((flags & InstrumentationFlagMemory) != 0) {
+        [self.memoryAccount recordTransient:MemoryCategoryCommand bytes:MemoryAccountSize(command)];
+        previousAccount = MemoryAccount.current;
+        MemoryAccount.current = self.memoryAccount;
+    }
+#endif
+    PUREMVC_PROBE3(command_execute, self.multitonKey.UTF8String, notification.name.UTF8String, object_getClassName(command));
     [command execute:notification];
+#if PUREMVC_INSTRUMENTATION
+    if ((flags & InstrumentationFlagMemory) != 0) MemoryAccount.current = previousAccount;
+    if (span != 0) [Tracer endSpan:span];
+    if (timed && [(id)self.view isKindOfClass:[View class]]) {
+        uint64_t latency = InstrumentationNow() - start;
+        if ((flags & InstrumentationFlagHistograms) != 0) [((View *)self.view).instrumentation recordCommand:notification.name latency:latency];
+        if ((flags & InstrumentationFlagWatchdog) != 0) [((View *)self.view).watchdog checkNotification:notification.name contextClass:[(id)command class] latency:latency];
+    }
+#endif
 }
 
 /**
@@ -204,9 +302,9 @@ Check if a Command is registered for a given Notification
 */
 - (BOOL)hasCommand:(NSString *)notificationName {
     __block BOOL exists = NO;
-    dispatch_sync(self.commandMapQueue, ^{
+    [self.commandMapLock read:^{
         exists = self.commandMap[notificationName] != nil;
-    });
+    }];
     return exists;
 }
 
@@ -216,12 +314,57 @@ Remove a previously registered `ICommand` to `INotification` mapping.
 - parameter notificationName: the name of the `INotification` to remove the `ICommand` mapping for
 */
 - (void)removeCommand:(NSString *)notificationName {
-    dispatch_barrier_sync(self.commandMapQueue, ^{
+    [self.commandMapLock write:^{
         if (self.commandMap[notificationName] != nil) {
             [self.view removeObserver:notificationName context:self];
             [self.commandMap removeObjectForKey:notificationName];
+            if (MemoryAccountingActive()) {
+                [self.memoryAccount recordRelease:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+                [self.memoryAccount recordRelease:MemoryCategoryObserver bytes:MemoryAccountObserverSize()];
+            }
         }
-    });
+    }];
+}
+
+/**
+Remove every `ICommand` mapping from the `Controller`.
+
+The command map is swapped out in a single barrier, and the
+`IObserver`s registered with the `View` for the mappings are removed
+with it in a single barrier on the View's observer map, so a command
+registered again is executed once.
+*/
+- (void)removeAllCommands {
+    __block NSUInteger count = 0;
+    [self.commandMapLock write:^{
+        count = self.commandMap.count;
+        NSArray<NSString *> *notificationNames = [self.commandMap allKeys];
+        if ([(id)self.view isKindOfClass:[View class]]) {
+            [(View *)self.view removeObservers:notificationNames context:self];
+        } else {
+            for (NSString *notificationName in notificationNames) {
+                [self.view removeObserver:notificationName context:self];
+            }
+        }
+        self.commandMap = [NSMutableDictionary dictionary];
+    }];
+    if (MemoryAccountingActive()) {
+        [self.memoryAccount recordRelease:MemoryCategoryMap bytes:count * MemoryAccountEntrySize];
+        [self.memoryAccount recordRelease:MemoryCategoryObserver bytes:count * MemoryAccountObserverSize()];
+    }
+}
+
+/**
+Take a snapshot of the `Controller`'s command mappings, for diagnostics.
+
+- returns: the command mappings, serializable with `NSJSONSerialization`
+*/
+- (NSDictionary<NSString *, id> *)introspect {
+    __block NSArray<NSString *> *names = nil;
+    [self.commandMapLock read:^{
+        names = [self.commandMap allKeys];
+    }];
+    return @{@"key": self.multitonKey, @"commands": [names sortedArrayUsingSelector:@selector(compare:)]};
 }
 
 @end
@@ -0,0 +1,339 @@
+//
+//  FlightRecorder.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <errno.h>
+#import <pthread.h>
+#import <stdatomic.h>
+#import <stdlib.h>
+#import <string.h>
+#import <unistd.h>
+#import "FlightRecorder.h"
+#import "Instrumentation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+enum {
+    /// Bytes kept of a notification name, including the terminator.
+    NameLength = 64,
+    /// Bytes kept of a notification type, including the terminator.
+    TypeLength = 36,
+    /// Bytes kept of a multiton key, including the terminator.
+    KeyLength = 64
+};
+
+/// One recorded notification, 128 bytes.
+typedef struct {
+    /// The record's position + 1 once written, 0 while being written.
+    atomic_uint_fast64_t sequence;
+    uint64_t timestamp;
+    uint64_t duration;
+    uint32_t fanout;
+    char name[NameLength];
+    char type[TypeLength];
+} FlightRecord;
+
+/// A Core's ring of records, recycled rather than freed so a signal-time walk never reads freed memory.
+typedef struct FlightRing {
+    /// The next ring in `rings`, set once before the ring is published.
+    struct FlightRing *next;
+    /// The next recycled ring, guarded by `freeRingsLock`.
+    struct FlightRing *nextFree;
+    /// Whether a `FlightRecorder` owns the ring.
+    atomic_bool live;
+    /// Position of the next record.
+    atomic_uint_fast64_t head;
+    /// Number of records, a power of two.
+    size_t capacity;
+    /// The records, allocated on first use.
+    _Atomic(FlightRecord *) records;
+    /// The multiton key of the Core.
+    char key[KeyLength];
+} FlightRing;
+
+/// Every ring ever created, newest first.
+static _Atomic(FlightRing *) rings = NULL;
+
+/// Rings released by their recorders, guarded by `freeRingsLock`.
+static FlightRing *freeRings = NULL;
+static pthread_mutex_t freeRingsLock = PTHREAD_MUTEX_INITIALIZER;
+
+/// Capacity of the recorders Views create.
+static atomic_size_t defaultCapacity = 256;
+
+/// Copy a string into a fixed buffer, truncated and terminated.
+static void copyString(NSString *_Nullable string, char *buffer, size_t length) {
+    NSUInteger used = 0;
+    [string getBytes:buffer maxLength:length - 1 usedLength:&used encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:NULL];
+    buffer[used] = '\0';
+}
+
+/// The ring's records, allocating them on first use.
+static FlightRecord *ringRecords(FlightRing *ring) {
+    FlightRecord *records = atomic_load_explicit(&ring->records, memory_order_acquire);
+    if (records != NULL) return records;
+    FlightRecord *created = calloc(ring->capacity, sizeof(FlightRecord));
+    if (atomic_compare_exchange_strong_explicit(&ring->records, &records, created, memory_order_acq_rel, memory_order_acquire)) return created;
+    free(created);
+    return records;
+}
+
+/// Take a recycled ring of the given capacity, or create and publish one.
+static FlightRing *acquireRing(size_t capacity) {
+    FlightRing *ring = NULL;
+    pthread_mutex_lock(&freeRingsLock);
+    for (FlightRing **link = &freeRings; *link != NULL; link = &(*link)->nextFree) {
+        if ((*link)->capacity == capacity) {
+            ring = *link;
+            *link = ring->nextFree;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&freeRingsLock);
+
+    if (ring != NULL) {
+        FlightRecord *records = atomic_load_explicit(&ring->records, memory_order_acquire);
+        if (records != NULL) {
+            for (size_t i = 0; i < capacity; i++) atomic_store_explicit(&records[i].sequence, 0, memory_order_relaxed);
+        }
+        atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+        return ring;
+    }
+
+    ring = calloc(1, sizeof(FlightRing));
+    ring->capacity = capacity;
+    ring->next = atomic_load_explicit(&rings, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&rings, &ring->next, ring, memory_order_release, memory_order_relaxed));
+    return ring;
+}
+
+/// Read the record at a position, NO if it was overwritten or is being written.
+static BOOL readRecord(FlightRecord *records, size_t capacity, uint64_t position, FlightRecord *out) {
+    FlightRecord *record = &records[position & (capacity - 1)];
+    uint64_t before = atomic_load_explicit(&record->sequence, memory_order_acquire);
+    if (before != position + 1) return NO;
+    out->timestamp = record->timestamp;
+    out->duration = record->duration;
+    out->fanout = record->fanout;
+    memcpy(out->name, record->name, NameLength);
+    memcpy(out->type, record->type, TypeLength);
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&record->sequence, memory_order_relaxed) != before) return NO;
+    out->name[NameLength - 1] = '\0';
+    out->type[TypeLength - 1] = '\0';
+    return YES;
+}
+
+/// Append a C string to a line buffer.
+static void appendString(char *line, size_t *length, size_t size, const char *string) {
+    while (*string != '\0' && *length < size - 1) line[(*length)++] = *string++;
+}
+
+/// Append an unsigned decimal to a line buffer.
+static void appendNumber(char *line, size_t *length, size_t size, uint64_t value) {
+    char digits[20];
+    int count = 0;
+    do { digits[count++] = (char)('0' + value % 10); value /= 10; } while (value != 0);
+    while (count > 0 && *length < size - 1) line[(*length)++] = digits[--count];
+}
+
+/// Write a buffer completely, retrying short writes and interruptions.
+static void writeAll(int fd, const char *buffer, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, buffer, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        buffer += written;
+        length -= (size_t)written;
+    }
+}
+
+/// Write a ring's records, oldest first, one line each; signal-safe.
+static void dumpRing(FlightRing *ring, int fd) {
+    FlightRecord *records = atomic_load_explicit(&ring->records, memory_order_acquire);
+    if (records == NULL) return;
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint64_t position = head > ring->capacity ? head - ring->capacity : 0;
+
+    char line[256];
+    FlightRecord record;
+    for (; position < head; position++) {
+        if (!readRecord(records, ring->capacity, position, &record)) continue;
+        size_t length = 0;
+        appendString(line, &length, sizeof(line), "core=");
+        appendString(line, &length, sizeof(line), ring->key);
+        appendString(line, &length, sizeof(line), " seq=");
+        appendNumber(line, &length, sizeof(line), position);
+        appendString(line, &length, sizeof(line), " timestamp=");
+        appendNumber(line, &length, sizeof(line), record.timestamp);
+        appendString(line, &length, sizeof(line), " duration=");
+        appendNumber(line, &length, sizeof(line), record.duration);
+        appendString(line, &length, sizeof(line), " fanout=");
+        appendNumber(line, &length, sizeof(line), record.fanout);
+        appendString(line, &length, sizeof(line), " name=");
+        appendString(line, &length, sizeof(line), record.name);
+        if (record.type[0] != '\0') {
+            appendString(line, &length, sizeof(line), " type=");
+            appendString(line, &length, sizeof(line), record.type);
+        }
+        line[length++] = '\n';
+        writeAll(fd, line, length);
+    }
+}
+
+void FlightRecorderDumpAll(int fd) {
+    for (FlightRing *ring = atomic_load_explicit(&rings, memory_order_acquire); ring != NULL; ring = ring->next) {
+        if (atomic_load_explicit(&ring->live, memory_order_acquire)) dumpRing(ring, fd);
+    }
+}
+
+/**
+A fixed-size ring of the notifications a Core most recently sent.
+
+Records live in a plain C ring. A record claims its position with one
+`fetch_add` on the head, and its sequence number, cleared while the
+record is written and set to the position + 1 after, lets readers
+detect records overwritten or written while they read them.
+
+Rings are linked into a process-wide list that is only ever pushed
+to. A ring released by its recorder is recycled for the next one of
+the same capacity instead of being freed, so `FlightRecorderDumpAll`
+can walk the list from a signal handler without locks.
+*/
+@implementation FlightRecorder {
+    /// The ring this recorder writes.
+    FlightRing *_ring;
+}
+
++ (BOOL)isEnabled {
+#if PUREMVC_INSTRUMENTATION
+    return (InstrumentationActiveFlags() & InstrumentationFlagFlightRecorder) != 0;
+#else
+    return NO;
+#endif
+}
+
++ (void)setEnabled:(BOOL)enabled {
+#if PUREMVC_INSTRUMENTATION
+    InstrumentationSetFlag(InstrumentationFlagFlightRecorder, enabled);
+#endif
+}
+
++ (NSUInteger)defaultCapacity {
+    return atomic_load(&defaultCapacity);
+}
+
++ (void)setDefaultCapacity:(NSUInteger)capacity {
+    atomic_store(&defaultCapacity, capacity);
+}
+
+/**
+Factory method to create a `FlightRecorder` for a Core.
+
+- parameter key: the multiton key of the Core
+- parameter capacity: the number of records to keep, rounded up to a power of two
+- returns: a new `FlightRecorder`
+*/
++ (instancetype)withKey:(NSString *)key capacity:(NSUInteger)capacity {
+    return [[FlightRecorder alloc] initWithKey:key capacity:capacity];
+}
+
+/**
+Constructor.
+
+- parameter key: the multiton key of the Core
+- parameter capacity: the number of records to keep, rounded up to a power of two
+- returns: a `FlightRecorder` with no records
+*/
+- (instancetype)initWithKey:(NSString *)key capacity:(NSUInteger)capacity {
+    if (self = [super init]) {
+        _multitonKey = [key copy];
+        _capacity = 2;
+        while (_capacity < capacity) _capacity <<= 1;
+        _ring = acquireRing(_capacity);
+        copyString(key, _ring->key, KeyLength);
+        atomic_store_explicit(&_ring->live, true, memory_order_release);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    atomic_store_explicit(&_ring->live, false, memory_order_release);
+    pthread_mutex_lock(&freeRingsLock);
+    _ring->nextFree = freeRings;
+    freeRings = _ring;
+    pthread_mutex_unlock(&freeRingsLock);
+}
+
+- (uint64_t)recordedCount {
+    return atomic_load_explicit(&_ring->head, memory_order_relaxed);
+}
+
+/**
+Record one send of a notification.
+
+- parameter notification: the notification sent
+- parameter start: when the send started, in monotonic nanoseconds
+- parameter duration: how long the send took, in nanoseconds
+- parameter fanout: the number of observers notified
+*/
+- (void)recordNotification:(id<INotification>)notification start:(uint64_t)start duration:(uint64_t)duration fanout:(NSUInteger)fanout {
+    FlightRecord *records = ringRecords(_ring);
+    uint64_t position = atomic_fetch_add_explicit(&_ring->head, 1, memory_order_relaxed);
+    FlightRecord *record = &records[position & (_ring->capacity - 1)];
+    atomic_store_explicit(&record->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    record->timestamp = start;
+    record->duration = duration;
+    record->fanout = (uint32_t)MIN(fanout, (NSUInteger)UINT32_MAX);
+    copyString(notification.name, record->name, NameLength);
+    copyString(notification.type, record->type, TypeLength);
+    atomic_store_explicit(&record->sequence, position + 1, memory_order_release);
+}
+
+/**
+The records still in the ring, oldest first.
+
+- returns: a dictionary per record
+*/
+- (NSArray<NSDictionary<NSString *, id> *> *)records {
+    FlightRecord *records = atomic_load_explicit(&_ring->records, memory_order_acquire);
+    if (records == NULL) return @[];
+    uint64_t head = atomic_load_explicit(&_ring->head, memory_order_acquire);
+    uint64_t position = head > _ring->capacity ? head - _ring->capacity : 0;
+
+    NSMutableArray<NSDictionary<NSString *, id> *> *result = [NSMutableArray arrayWithCapacity:(NSUInteger)(head - position)];
+    FlightRecord record;
+    for (; position < head; position++) {
+        if (!readRecord(records, _ring->capacity, position, &record)) continue;
+        NSMutableDictionary<NSString *, id> *entry = [NSMutableDictionary dictionaryWithDictionary:@{
+            @"timestamp": @(record.timestamp),
+            @"duration": @(record.duration),
+            @"fanout": @(record.fanout),
+            @"name": [NSString stringWithUTF8String:record.name] ?: @""
+        }];
+        if (record.type[0] != '\0') entry[@"type"] = [NSString stringWithUTF8String:record.type] ?: @"";
+        [result addObject:entry];
+    }
+    return result;
+}
+
+/**
+Write the records to a file descriptor, oldest first, one line each.
+
+- parameter fd: the file descriptor to write to
+*/
+- (void)dumpToFileDescriptor:(int)fd {
+    dumpRing(_ring, fd);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,90 @@
+//
+//  Handle.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import "Handle.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface Handle()
+
+/// The current registrant. Atomic, so readers never observe a released object.
+@property (atomic, strong, nullable) id current;
+
+/// Resolves a registrant that is created lazily on first retrieval.
+@property (nonatomic, copy, nullable) id _Nullable (^resolver)(NSString *name);
+
+@end
+
+/**
+A base `IHandle` implementation.
+
+A `Handle` holds the registrant for a name, and is updated by
+the `Model` or `View` that created it as registrants come and go.
+Reading `target` costs one atomic load instead of a trip through
+the `Facade`, the registry queue and a string-keyed lookup.
+
+`@see Model`
+`@see View`
+*/
+@implementation Handle
+
+/**
+ * Creates and returns a new `Handle` for the given name.
+ *
+ * @param name The registrant name.
+ * @param resolver Optional block called when `target` is nil.
+ * @return A new `Handle` instance.
+ */
++ (instancetype)withName:(NSString *)name resolver:(nullable id _Nullable (^)(NSString *name))resolver {
+    return [[self alloc] initWithName:name resolver:resolver];
+}
+
+/**
+Constructor.
+
+- parameter name: the registrant name
+- parameter resolver: optional block called when `target` is nil
+*/
+- (instancetype)initWithName:(NSString *)name resolver:(nullable id _Nullable (^)(NSString *name))resolver {
+    if (self = [super init]) {
+        _name = [name copy];
+        _resolver = [resolver copy];
+    }
+    return self;
+}
+
+/**
+The current registrant.
+
+When nothing is currently held, the resolver is given a chance
+to create a lazily registered registrant, which updates this
+handle as a side effect of its registration.
+
+- returns: the current registrant, or nil
+*/
+- (nullable id)target {
+    id target = self.current;
+    if (target == nil && self.resolver != nil) {
+        target = self.resolver(self.name);
+    }
+    return target;
+}
+
+/**
+Point the handle at a new registrant.
+
+- parameter target: the current registrant, or nil
+*/
+- (void)updateTarget:(nullable id)target {
+    self.current = target;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
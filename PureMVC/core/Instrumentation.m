@@ -0,0 +1,186 @@
+//
+//  Instrumentation.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <stdatomic.h>
+#import "Instrumentation.h"
+#import "VersionedReference.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+#if PUREMVC_INSTRUMENTATION
+atomic_uint InstrumentationFlags = InstrumentationFlagFlightRecorder;
+#endif
+
+@interface Instrumentation()
+
+/// `notifyObservers:` latencies keyed by notification name.
+@property (nonatomic, strong, readonly) VersionedReference<NSDictionary<NSString *, LatencyHistogram *> *> *notificationMap;
+
+/// Observers notified per send, keyed by notification name.
+@property (nonatomic, strong, readonly) VersionedReference<NSDictionary<NSString *, LatencyHistogram *> *> *fanoutMap;
+
+/// Per-observer latencies keyed by the class of the observer's context.
+@property (nonatomic, strong, readonly) VersionedReference<NSDictionary<Class, LatencyHistogram *> *> *observerMap;
+
+/// `executeCommand:` latencies keyed by notification name.
+@property (nonatomic, strong, readonly) VersionedReference<NSDictionary<NSString *, LatencyHistogram *> *> *commandMap;
+
+@end
+
+/**
+Latency and fanout histograms of a Core's notification dispatch.
+
+Each map of histograms is an immutable dictionary published through a
+`VersionedReference`, so recording looks up its histogram without a
+lock and counts into it with atomics. Only the first record of a new
+key copies the dictionary, under the reference's writer lock.
+*/
+@implementation Instrumentation
+
++ (BOOL)isEnabled {
+#if PUREMVC_INSTRUMENTATION
+    return (InstrumentationActiveFlags() & InstrumentationFlagHistograms) != 0;
+#else
+    return NO;
+#endif
+}
+
++ (void)setEnabled:(BOOL)enabled {
+#if PUREMVC_INSTRUMENTATION
+    InstrumentationSetFlag(InstrumentationFlagHistograms, enabled);
+#endif
+}
+
+/**
+Factory method to create an empty `Instrumentation`.
+
+- returns: a new `Instrumentation`
+*/
++ (instancetype)instrumentation {
+    return [[self alloc] init];
+}
+
+/**
+Constructor.
+
+- returns: an `Instrumentation` without histograms
+*/
+- (instancetype)init {
+    if (self = [super init]) {
+        _notificationMap = [VersionedReference withValue:@{}];
+        _fanoutMap = [VersionedReference withValue:@{}];
+        _observerMap = [VersionedReference withValue:@{}];
+        _commandMap = [VersionedReference withValue:@{}];
+    }
+    return self;
+}
+
+/**
+Record one send of a notification.
+
+- parameter notificationName: the name of the notification
+- parameter latency: the time spent notifying its observers, in nanoseconds
+- parameter fanout: the number of observers notified
+*/
+- (void)recordNotification:(NSString *)notificationName latency:(uint64_t)latency fanout:(NSUInteger)fanout {
+    [[self histogramIn:self.notificationMap forKey:notificationName] recordValue:latency];
+    [[self histogramIn:self.fanoutMap forKey:notificationName] recordValue:fanout];
+}
+
+/**
+Record one notification of an observer.
+
+- parameter contextClass: the class of the observer's context
+- parameter latency: the time spent in the observer, in nanoseconds
+*/
+- (void)recordObserver:(Class)contextClass latency:(uint64_t)latency {
+    [[self histogramIn:self.observerMap forKey:(id<NSCopying>)contextClass] recordValue:latency];
+}
+
+/**
+Record one execution of a command.
+
+- parameter notificationName: the name of the notification that triggered the command
+- parameter latency: the time spent executing the command, in nanoseconds
+*/
+- (void)recordCommand:(NSString *)notificationName latency:(uint64_t)latency {
+    [[self histogramIn:self.commandMap forKey:notificationName] recordValue:latency];
+}
+
+/**
+The histogram for a key, created on first use.
+
+- parameter map: the map of histograms to look in
+- parameter key: the key of the histogram
+- returns: the histogram for `key`
+*/
+- (LatencyHistogram *)histogramIn:(VersionedReference<NSDictionary *> *)map forKey:(id<NSCopying>)key {
+    LatencyHistogram *histogram = [map load][key];
+    if (histogram != nil) return histogram;
+
+    __block LatencyHistogram *created = nil;
+    [map update:^NSDictionary *(NSDictionary *current) {
+        created = current[key];
+        if (created != nil) return current;
+        created = [LatencyHistogram histogram];
+        NSMutableDictionary *next = [current mutableCopy];
+        next[key] = created;
+        return [next copy];
+    }];
+    return created;
+}
+
+/**
+Snapshot every histogram of a map.
+
+- parameter map: the map of histograms
+- returns: snapshots keyed by the map's keys, with classes keyed by name
+*/
+- (NSDictionary<NSString *, LatencyHistogram *> *)snapshotOf:(VersionedReference<NSDictionary *> *)map {
+    NSDictionary *histograms = [map load];
+    NSMutableDictionary<NSString *, LatencyHistogram *> *snapshots = [NSMutableDictionary dictionaryWithCapacity:histograms.count];
+    [histograms enumerateKeysAndObjectsUsingBlock:^(id key, LatencyHistogram *histogram, BOOL *stop) {
+        NSString *name = [key isKindOfClass:[NSString class]] ? key : NSStringFromClass(key);
+        snapshots[name] = [histogram snapshot];
+    }];
+    return [snapshots copy];
+}
+
+- (NSDictionary<NSString *, LatencyHistogram *> *)notificationLatencies {
+    return [self snapshotOf:self.notificationMap];
+}
+
+- (NSDictionary<NSString *, LatencyHistogram *> *)notificationFanouts {
+    return [self snapshotOf:self.fanoutMap];
+}
+
+- (NSDictionary<NSString *, LatencyHistogram *> *)observerLatencies {
+    return [self snapshotOf:self.observerMap];
+}
+
+- (NSDictionary<NSString *, LatencyHistogram *> *)commandLatencies {
+    return [self snapshotOf:self.commandMap];
+}
+
+/**
+Clear every histogram.
+
+Histograms are reset in place, so recorders holding one keep counting into the map.
+*/
+- (void)reset {
+    for (VersionedReference<NSDictionary *> *map in @[self.notificationMap, self.fanoutMap, self.observerMap, self.commandMap]) {
+        for (LatencyHistogram *histogram in [[map load] objectEnumerator]) {
+            [histogram reset];
+        }
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,228 @@
+//
+//  LatencyHistogram.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <stdatomic.h>
+#import <stdlib.h>
+#import <math.h>
+#import "LatencyHistogram.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+enum {
+    /// Bits of linear resolution within each power of two.
+    SubBucketBits = 5,
+    /// Linear sub-buckets per power of two.
+    SubBucketCount = 1 << SubBucketBits,
+    /// The largest power of two with its own buckets, larger values share the last bucket.
+    MaxExponent = 40,
+    /// The number of buckets, values below `SubBucketCount` get one each.
+    BucketCount = (MaxExponent - SubBucketBits + 1) * SubBucketCount + SubBucketCount
+};
+
+/// The bucket counting `value`.
+static inline size_t bucketIndex(uint64_t value) {
+    if (value < SubBucketCount) return (size_t)value;
+    unsigned exponent = 63 - (unsigned)__builtin_clzll(value);
+    if (exponent > MaxExponent) return BucketCount - 1;
+    uint64_t subBucket = (value >> (exponent - SubBucketBits)) - SubBucketCount;
+    return (exponent - SubBucketBits + 1) * SubBucketCount + (size_t)subBucket;
+}
+
+/// The highest value counted by the bucket at `index`.
+static inline uint64_t highestEquivalentValue(size_t index) {
+    if (index < SubBucketCount) return index;
+    unsigned exponent = (unsigned)(index / SubBucketCount) + SubBucketBits - 1;
+    uint64_t mantissa = SubBucketCount + index % SubBucketCount;
+    return ((mantissa + 1) << (exponent - SubBucketBits)) - 1;
+}
+
+/**
+A lock-free log-linear histogram.
+
+Each bucket is an atomic counter incremented with a relaxed
+`fetch_add`, so concurrent recorders never wait on each other. The
+minimum and maximum are maintained with compare-and-swap loops that
+only retry while the recorded value still improves on them.
+*/
+@implementation LatencyHistogram {
+    /// The bucket counters, `BucketCount` of them.
+    _Atomic(uint64_t) *_counts;
+
+    /// The number of recorded values.
+    _Atomic(uint64_t) _count;
+
+    /// The sum of the recorded values.
+    _Atomic(uint64_t) _sum;
+
+    /// The smallest recorded value, `UINT64_MAX` while empty.
+    _Atomic(uint64_t) _min;
+
+    /// The largest recorded value.
+    _Atomic(uint64_t) _max;
+}
+
+/**
+Factory method to create an empty `LatencyHistogram`.
+
+- returns: a new `LatencyHistogram`
+*/
++ (instancetype)histogram {
+    return [[self alloc] init];
+}
+
+/**
+Constructor.
+
+- returns: an empty `LatencyHistogram`
+*/
+- (instancetype)init {
+    if (self = [super init]) {
+        _counts = calloc(BucketCount, sizeof(_Atomic(uint64_t)));
+        atomic_init(&_count, 0);
+        atomic_init(&_sum, 0);
+        atomic_init(&_min, UINT64_MAX);
+        atomic_init(&_max, 0);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_counts);
+}
+
+/**
+Record a value.
+
+- parameter value: the value to count
+*/
+- (void)recordValue:(uint64_t)value {
+    atomic_fetch_add_explicit(&_counts[bucketIndex(value)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&_count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&_sum, value, memory_order_relaxed);
+
+    uint64_t min = atomic_load_explicit(&_min, memory_order_relaxed);
+    while (value < min && !atomic_compare_exchange_weak_explicit(&_min, &min, value, memory_order_relaxed, memory_order_relaxed));
+    uint64_t max = atomic_load_explicit(&_max, memory_order_relaxed);
+    while (value > max && !atomic_compare_exchange_weak_explicit(&_max, &max, value, memory_order_relaxed, memory_order_relaxed));
+}
+
+- (uint64_t)count {
+    return atomic_load_explicit(&_count, memory_order_relaxed);
+}
+
+- (uint64_t)sum {
+    return atomic_load_explicit(&_sum, memory_order_relaxed);
+}
+
+- (uint64_t)min {
+    uint64_t min = atomic_load_explicit(&_min, memory_order_relaxed);
+    return min == UINT64_MAX ? 0 : min;
+}
+
+- (uint64_t)max {
+    return atomic_load_explicit(&_max, memory_order_relaxed);
+}
+
+- (double)mean {
+    uint64_t count = self.count;
+    return count == 0 ? 0 : (double)self.sum / (double)count;
+}
+
+/**
+The value at or below which the given percentage of recorded values fall.
+
+- parameter percentile: the percentile, from 0 to 100
+- returns: the highest value equivalent to the bucket holding the percentile, capped at `max`
+*/
+- (uint64_t)valueAtPercentile:(double)percentile {
+    uint64_t total = 0;
+    for (size_t i = 0; i < BucketCount; i++) {
+        total += atomic_load_explicit(&_counts[i], memory_order_relaxed);
+    }
+    if (total == 0) return 0;
+
+    double clamped = fmin(fmax(percentile, 0), 100);
+    uint64_t target = (uint64_t)ceil(clamped / 100 * (double)total);
+    if (target == 0) target = 1;
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BucketCount; i++) {
+        seen += atomic_load_explicit(&_counts[i], memory_order_relaxed);
+        if (seen >= target) return MIN(highestEquivalentValue(i), self.max);
+    }
+    return self.max;
+}
+
+/**
+Copy the current counts into a new histogram.
+
+The copy's count is the total of its buckets, so its percentiles
+agree with its count even if values were being recorded meanwhile.
+
+- returns: a snapshot of this histogram
+*/
+- (LatencyHistogram *)snapshot {
+    LatencyHistogram *snapshot = [LatencyHistogram histogram];
+    uint64_t count = 0;
+    for (size_t i = 0; i < BucketCount; i++) {
+        uint64_t bucket = atomic_load_explicit(&_counts[i], memory_order_relaxed);
+        atomic_store_explicit(&snapshot->_counts[i], bucket, memory_order_relaxed);
+        count += bucket;
+    }
+    atomic_store_explicit(&snapshot->_count, count, memory_order_relaxed);
+    atomic_store_explicit(&snapshot->_sum, atomic_load_explicit(&_sum, memory_order_relaxed), memory_order_relaxed);
+    atomic_store_explicit(&snapshot->_min, atomic_load_explicit(&_min, memory_order_relaxed), memory_order_relaxed);
+    atomic_store_explicit(&snapshot->_max, atomic_load_explicit(&_max, memory_order_relaxed), memory_order_relaxed);
+    return snapshot;
+}
+
+/**
+Add the counts of another histogram to this one.
+
+- parameter histogram: the histogram to add
+*/
+- (void)addHistogram:(LatencyHistogram *)histogram {
+    LatencyHistogram *other = [histogram snapshot];
+    for (size_t i = 0; i < BucketCount; i++) {
+        uint64_t bucket = atomic_load_explicit(&other->_counts[i], memory_order_relaxed);
+        if (bucket != 0) atomic_fetch_add_explicit(&_counts[i], bucket, memory_order_relaxed);
+    }
+    atomic_fetch_add_explicit(&_count, atomic_load_explicit(&other->_count, memory_order_relaxed), memory_order_relaxed);
+    atomic_fetch_add_explicit(&_sum, atomic_load_explicit(&other->_sum, memory_order_relaxed), memory_order_relaxed);
+
+    uint64_t value = atomic_load_explicit(&other->_min, memory_order_relaxed);
+    uint64_t min = atomic_load_explicit(&_min, memory_order_relaxed);
+    while (value < min && !atomic_compare_exchange_weak_explicit(&_min, &min, value, memory_order_relaxed, memory_order_relaxed));
+    value = atomic_load_explicit(&other->_max, memory_order_relaxed);
+    uint64_t max = atomic_load_explicit(&_max, memory_order_relaxed);
+    while (value > max && !atomic_compare_exchange_weak_explicit(&_max, &max, value, memory_order_relaxed, memory_order_relaxed));
+}
+
+/**
+Clear all counts.
+*/
+- (void)reset {
+    for (size_t i = 0; i < BucketCount; i++) {
+        atomic_store_explicit(&_counts[i], 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&_count, 0, memory_order_relaxed);
+    atomic_store_explicit(&_sum, 0, memory_order_relaxed);
+    atomic_store_explicit(&_min, UINT64_MAX, memory_order_relaxed);
+    atomic_store_explicit(&_max, 0, memory_order_relaxed);
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@ count=%llu min=%llu p50=%llu p99=%llu max=%llu>", NSStringFromClass([self class]),
+            (unsigned long long)self.count, (unsigned long long)self.min, (unsigned long long)[self valueAtPercentile:50],
+            (unsigned long long)[self valueAtPercentile:99], (unsigned long long)self.max];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,357 @@
+//
+//  MapLock.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <pthread.h>
+#import <sched.h>
+#import <stdatomic.h>
+#import <stdlib.h>
+#import <limits.h>
+#import "MapLock.h"
+#import "Confinement.h"
+#import "MultitonRegistry.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+enum {
+    /// Spins before a waiting thread yields its core.
+    SpinLimit = 64,
+    /// Reader counters of a read-mostly lock, each on its own cache line.
+    ReadMostlyStripes = 16,
+    /// Bytes of a cache line.
+    CacheLineSize = 64
+};
+
+/// Strategies chosen per Core, keyed by multiton key.
+static MultitonRegistry<NSNumber *> *strategies = nil;
+
+/// Initializes the strategy registry.
+__attribute__((constructor()))
+static void initialize(void) {
+    strategies = [MultitonRegistry registry];
+}
+
+/**
+Wait a little while spinning, yielding the core after `SpinLimit` spins.
+
+- parameter spins: the number of spins so far, incremented
+*/
+static inline void spinWait(unsigned *spins) {
+    if (++*spins < SpinLimit) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    } else {
+        *spins = 0;
+        sched_yield();
+    }
+}
+
+#pragma mark - Dispatch
+
+/// Reads with `dispatch_sync` and writes with `dispatch_barrier_sync` on a concurrent queue.
+@interface DispatchMapLock : NSObject <IMapLock>
+@property (nonatomic, strong) dispatch_queue_t queue;
+@end
+
+@implementation DispatchMapLock
+
+- (instancetype)initWithLabel:(NSString *)label {
+    if (self = [super init]) {
+        _queue = dispatch_queue_create(label.UTF8String, DISPATCH_QUEUE_CONCURRENT);
+    }
+    return self;
+}
+
+- (void)read:(NS_NOESCAPE dispatch_block_t)block {
+    dispatch_sync(self.queue, block);
+}
+
+- (void)write:(NS_NOESCAPE dispatch_block_t)block {
+    dispatch_barrier_sync(self.queue, block);
+}
+
+@end
+
+#pragma mark - ReadWrite
+
+/// A `pthread_rwlock_t`.
+@interface ReadWriteMapLock : NSObject <IMapLock>
+@end
+
+@implementation ReadWriteMapLock {
+    pthread_rwlock_t _lock;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        pthread_rwlock_init(&_lock, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    pthread_rwlock_destroy(&_lock);
+}
+
+- (void)read:(NS_NOESCAPE dispatch_block_t)block {
+    pthread_rwlock_rdlock(&_lock);
+    block();
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (void)write:(NS_NOESCAPE dispatch_block_t)block {
+    pthread_rwlock_wrlock(&_lock);
+    block();
+    pthread_rwlock_unlock(&_lock);
+}
+
+@end
+
+#pragma mark - Spin
+
+enum {
+    /// Set while a writer holds the lock.
+    SpinWriter = 1 << 30,
+    /// Set while a writer waits, holding off new readers.
+    SpinPending = 1 << 29
+};
+
+/**
+A reader-writer spinlock: the reader count, the writer and a waiting
+writer share one atomic word, so an uncontended read costs two atomic
+operations and never enters the kernel.
+*/
+@interface SpinMapLock : NSObject <IMapLock>
+@end
+
+@implementation SpinMapLock {
+    atomic_uint _state;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        atomic_init(&_state, 0);
+    }
+    return self;
+}
+
+- (void)read:(NS_NOESCAPE dispatch_block_t)block {
+    unsigned spins = 0;
+    for (;;) {
+        unsigned state = atomic_load_explicit(&_state, memory_order_relaxed);
+        if ((state & (SpinWriter | SpinPending)) == 0 &&
+            atomic_compare_exchange_weak_explicit(&_state, &state, state + 1, memory_order_acquire, memory_order_relaxed)) break;
+        spinWait(&spins);
+    }
+    block();
+    atomic_fetch_sub_explicit(&_state, 1, memory_order_release);
+}
+
+- (void)write:(NS_NOESCAPE dispatch_block_t)block {
+    unsigned spins = 0;
+    for (;;) {
+        unsigned state = atomic_load_explicit(&_state, memory_order_relaxed);
+        // no readers and no writer; taking the lock clears the pending bit
+        if ((state & ~(unsigned)SpinPending) == 0 &&
+            atomic_compare_exchange_weak_explicit(&_state, &state, SpinWriter, memory_order_acquire, memory_order_relaxed)) break;
+        if ((state & SpinPending) == 0) atomic_fetch_or_explicit(&_state, SpinPending, memory_order_relaxed);
+        spinWait(&spins);
+    }
+    block();
+    // keeps the pending bit of a writer that arrived meanwhile
+    atomic_fetch_and_explicit(&_state, ~(unsigned)SpinWriter, memory_order_release);
+}
+
+@end
+
+#pragma mark - ReadMostly
+
+/// A reader counter padded to a cache line.
+typedef struct {
+    atomic_uint readers;
+    char padding[CacheLineSize - sizeof(atomic_uint)];
+} ReadMostlyStripe;
+
+/// The next stripe handed to a thread.
+static atomic_uint nextStripe = 0;
+
+/// The stripe of the calling thread, assigned round robin on first use.
+static __thread unsigned threadStripe = UINT_MAX;
+
+/**
+A read-mostly lock in the manner of RCU: a reader only increments the
+counter of its thread's stripe, so readers on different cores never
+write a shared cache line. A writer raises a flag and waits for a
+grace period in which every stripe drains, then writes alone.
+Writers are serialized by a mutex and pay for every stripe.
+*/
+@interface ReadMostlyMapLock : NSObject <IMapLock>
+@end
+
+@implementation ReadMostlyMapLock {
+    /// The reader counters, aligned to a cache line.
+    ReadMostlyStripe *_stripes;
+    atomic_bool _writing;
+    pthread_mutex_t _writerLock;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        void *stripes = NULL;
+        if (posix_memalign(&stripes, CacheLineSize, ReadMostlyStripes * sizeof(ReadMostlyStripe)) != 0) return nil;
+        _stripes = stripes;
+        for (size_t i = 0; i < ReadMostlyStripes; i++) atomic_init(&_stripes[i].readers, 0);
+        atomic_init(&_writing, false);
+        pthread_mutex_init(&_writerLock, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    pthread_mutex_destroy(&_writerLock);
+    free(_stripes);
+}
+
+- (void)read:(NS_NOESCAPE dispatch_block_t)block {
+    if (threadStripe == UINT_MAX) threadStripe = atomic_fetch_add_explicit(&nextStripe, 1, memory_order_relaxed) % ReadMostlyStripes;
+    atomic_uint *readers = &_stripes[threadStripe].readers;
+    unsigned spins = 0;
+    for (;;) {
+        // sequentially consistent, pairs with the writer's store of _writing and loads of the stripes
+        atomic_fetch_add(readers, 1);
+        if (!atomic_load(&_writing)) break;
+        atomic_fetch_sub_explicit(readers, 1, memory_order_release);
+        while (atomic_load_explicit(&_writing, memory_order_relaxed)) spinWait(&spins);
+    }
+    block();
+    atomic_fetch_sub_explicit(readers, 1, memory_order_release);
+}
+
+- (void)write:(NS_NOESCAPE dispatch_block_t)block {
+    pthread_mutex_lock(&_writerLock);
+    atomic_store(&_writing, true);
+    unsigned spins = 0;
+    for (size_t i = 0; i < ReadMostlyStripes; i++) {
+        while (atomic_load(&_stripes[i].readers) != 0) spinWait(&spins);
+    }
+    block();
+    atomic_store_explicit(&_writing, false, memory_order_release);
+    pthread_mutex_unlock(&_writerLock);
+}
+
+@end
+
+#pragma mark - Confined
+
+/// No synchronization, asserting the owning thread.
+@interface ConfinedMapLock : NSObject <IMapLock>
+@property (nonatomic, strong) Confinement *confinement;
+@end
+
+@implementation ConfinedMapLock
+
+- (instancetype)initWithConfinement:(Confinement *)confinement {
+    if (self = [super init]) {
+        _confinement = confinement;
+    }
+    return self;
+}
+
+- (void)read:(NS_NOESCAPE dispatch_block_t)block {
+    NSAssert(self.confinement.isOwnerThread, @"Core '%@' accessed off the thread it is confined to.", self.confinement.multitonKey);
+    block();
+}
+
+- (void)write:(NS_NOESCAPE dispatch_block_t)block {
+    NSAssert(self.confinement.isOwnerThread, @"Core '%@' accessed off the thread it is confined to.", self.confinement.multitonKey);
+    block();
+}
+
+@end
+
+#pragma mark - MapLock
+
+/**
+The `IMapLock` implementations, and the strategy each Core uses.
+*/
+@implementation MapLock
+
+/**
+Choose the strategy of a Core, for the actors created afterwards.
+
+- parameter strategy: the strategy; `MapLockStrategyConfined` confines the Core to the calling thread
+- parameter key: the multiton key of the Core
+*/
++ (void)setStrategy:(MapLockStrategy)strategy forCore:(NSString *)key {
+    [strategies setObject:@(strategy) forKey:key];
+    if (strategy == MapLockStrategyConfined) {
+        [Confinement confineCore:key];
+    } else {
+        [Confinement removeConfinement:key];
+    }
+}
+
+/**
+The strategy of a Core.
+
+- parameter key: the multiton key of the Core
+- returns: the Core's strategy, `MapLockStrategyDispatch` unless another was chosen
+*/
++ (MapLockStrategy)strategyForCore:(NSString *)key {
+    if ([Confinement confinementForKey:key] != nil) return MapLockStrategyConfined;
+    NSNumber *strategy = [strategies objectForKey:key];
+    return strategy != nil ? (MapLockStrategy)strategy.integerValue : MapLockStrategyDispatch;
+}
+
+/**
+Forget the strategy of a Core, and release it from `Confinement`.
+
+- parameter key: the multiton key of the Core
+*/
++ (void)removeStrategyForCore:(NSString *)key {
+    [strategies removeObjectForKey:key];
+    [Confinement removeConfinement:key];
+}
+
+/**
+Create a lock with the strategy of a Core.
+
+- parameter key: the multiton key of the Core
+- parameter label: a label for the lock
+- returns: a new lock
+*/
++ (id<IMapLock>)lockForCore:(NSString *)key label:(NSString *)label {
+    Confinement *confinement = [Confinement confinementForKey:key];
+    if (confinement != nil) return [[ConfinedMapLock alloc] initWithConfinement:confinement];
+    return [self lockWithStrategy:[self strategyForCore:key] label:label];
+}
+
+/**
+Create a lock with a strategy.
+
+- parameter strategy: the strategy
+- parameter label: a label for the lock
+- returns: a new lock
+*/
++ (id<IMapLock>)lockWithStrategy:(MapLockStrategy)strategy label:(NSString *)label {
+    switch (strategy) {
+        case MapLockStrategyReadWrite: return [[ReadWriteMapLock alloc] init];
+        case MapLockStrategySpin: return [[SpinMapLock alloc] init];
+        case MapLockStrategyReadMostly: return [[ReadMostlyMapLock alloc] init];
+        case MapLockStrategyConfined: return [[ConfinedMapLock alloc] initWithConfinement:[[Confinement alloc] initWithKey:label]];
+        case MapLockStrategyDispatch: break;
+    }
+    return [[DispatchMapLock alloc] initWithLabel:label];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,295 @@
+//
+//  MemoryAccount.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <objc/runtime.h>
+#import <stdatomic.h>
+#import "MemoryAccount.h"
+#import "MultitonRegistry.h"
+#import "IMemoryFootprint.h"
+#import "Observer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+enum {
+    /// The number of `MemoryCategory` values.
+    MemoryCategoryCount = MemoryCategoryCommand + 1
+};
+
+/// The counters of one category.
+typedef struct {
+    atomic_uint_fast64_t allocations;
+    atomic_uint_fast64_t allocatedBytes;
+    atomic_int_fast64_t liveBytes;
+} MemoryCounters;
+
+/// Accounts keyed by multiton key.
+static MultitonRegistry<MemoryAccount *> *accounts = nil;
+
+/// Initializes the account registry.
+__attribute__((constructor()))
+static void initialize(void) {
+    accounts = [MultitonRegistry registry];
+}
+
+size_t MemoryAccountSize(id object) {
+    return class_getInstanceSize(object_getClass(object));
+}
+
+size_t MemoryAccountObserverSize(void) {
+    return class_getInstanceSize([Observer class]);
+}
+
+/// The account of the Core whose command is executing on this thread; the Controller keeps it alive meanwhile.
+static __thread __unsafe_unretained MemoryAccount *currentAccount = nil;
+
+/// The name of a category in `report`.
+static NSString *categoryName(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategoryObserver: return @"observers";
+        case MemoryCategoryObserverList: return @"observer_lists";
+        case MemoryCategoryMap: return @"maps";
+        case MemoryCategoryNotification: return @"notifications";
+        case MemoryCategoryCommand: return @"commands";
+    }
+    return @"unknown";
+}
+
+@interface MemoryAccount()
+
+/// Sources of `IMemoryFootprint` objects, guarded by synchronizing on the array.
+@property (nonatomic, strong) NSMutableArray<NSArray * _Nullable (^)(void)> *payloadSources;
+
+@end
+
+/**
+Memory attributed to one Core.
+
+Every counter is an atomic updated with relaxed ordering, so
+recording never blocks and a report is a set of independent reads.
+*/
+@implementation MemoryAccount {
+    MemoryCounters _counters[MemoryCategoryCount];
+}
+
++ (BOOL)isEnabled {
+#if PUREMVC_INSTRUMENTATION
+    return (InstrumentationActiveFlags() & InstrumentationFlagMemory) != 0;
+#else
+    return NO;
+#endif
+}
+
++ (void)setEnabled:(BOOL)enabled {
+#if PUREMVC_INSTRUMENTATION
+    InstrumentationSetFlag(InstrumentationFlagMemory, enabled);
+#endif
+}
+
++ (nullable MemoryAccount *)current {
+    return currentAccount;
+}
+
++ (void)setCurrent:(nullable MemoryAccount *)current {
+    currentAccount = current;
+}
+
+/**
+The account of a Core, created if needed.
+
+- parameter key: the multiton key of the Core
+- returns: the Core's account
+*/
++ (MemoryAccount *)getInstance:(NSString *)key {
+    return [accounts objectForKey:key factory:^(NSString *k) { return [[MemoryAccount alloc] initWithKey:k]; }];
+}
+
+/**
+The account of a Core, if it has one.
+
+- parameter key: the multiton key of the Core
+- returns: the Core's account, or nil
+*/
++ (nullable MemoryAccount *)accountForKey:(NSString *)key {
+    return [accounts objectForKey:key];
+}
+
+/**
+Remove the account of a Core.
+
+- parameter key: the multiton key of the Core
+*/
++ (void)removeAccount:(NSString *)key {
+    [accounts removeObjectForKey:key];
+}
+
+/**
+Constructor.
+
+- parameter key: the multiton key of the Core
+- returns: an empty account
+*/
+- (instancetype)initWithKey:(NSString *)key {
+    if (self = [super init]) {
+        _multitonKey = [key copy];
+        _payloadSources = [NSMutableArray array];
+        for (size_t i = 0; i < MemoryCategoryCount; i++) {
+            atomic_init(&_counters[i].allocations, 0);
+            atomic_init(&_counters[i].allocatedBytes, 0);
+            atomic_init(&_counters[i].liveBytes, 0);
+        }
+    }
+    return self;
+}
+
+- (uint64_t)allocationsInCategory:(MemoryCategory)category {
+    return category < MemoryCategoryCount ? atomic_load_explicit(&_counters[category].allocations, memory_order_relaxed) : 0;
+}
+
+- (uint64_t)allocatedBytesInCategory:(MemoryCategory)category {
+    return category < MemoryCategoryCount ? atomic_load_explicit(&_counters[category].allocatedBytes, memory_order_relaxed) : 0;
+}
+
+- (int64_t)liveBytesInCategory:(MemoryCategory)category {
+    return category < MemoryCategoryCount ? atomic_load_explicit(&_counters[category].liveBytes, memory_order_relaxed) : 0;
+}
+
+- (uint64_t)allocations {
+    uint64_t total = 0;
+    for (MemoryCategory category = 0; category < MemoryCategoryCount; category++) total += [self allocationsInCategory:category];
+    return total;
+}
+
+- (uint64_t)allocatedBytes {
+    uint64_t total = 0;
+    for (MemoryCategory category = 0; category < MemoryCategoryCount; category++) total += [self allocatedBytesInCategory:category];
+    return total;
+}
+
+- (int64_t)liveBytes {
+    int64_t total = 0;
+    for (MemoryCategory category = 0; category < MemoryCategoryCount; category++) total += [self liveBytesInCategory:category];
+    return total;
+}
+
+/**
+Record storage the Core holds until it is released.
+
+- parameter category: the category
+- parameter bytes: the bytes allocated
+*/
+- (void)recordAllocation:(MemoryCategory)category bytes:(size_t)bytes {
+    if (category >= MemoryCategoryCount) return;
+    atomic_fetch_add_explicit(&_counters[category].allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&_counters[category].allocatedBytes, bytes, memory_order_relaxed);
+    atomic_fetch_add_explicit(&_counters[category].liveBytes, (int64_t)bytes, memory_order_relaxed);
+}
+
+/**
+Record the release of storage recorded with `recordAllocation:bytes:`.
+
+- parameter category: the category
+- parameter bytes: the bytes released
+*/
+- (void)recordRelease:(MemoryCategory)category bytes:(size_t)bytes {
+    if (category >= MemoryCategoryCount) return;
+    atomic_fetch_sub_explicit(&_counters[category].liveBytes, (int64_t)bytes, memory_order_relaxed);
+}
+
+/**
+Record a short-lived allocation, counted but not held.
+
+- parameter category: the category
+- parameter bytes: the bytes allocated
+*/
+- (void)recordTransient:(MemoryCategory)category bytes:(size_t)bytes {
+    if (category >= MemoryCategoryCount) return;
+    atomic_fetch_add_explicit(&_counters[category].allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&_counters[category].allocatedBytes, bytes, memory_order_relaxed);
+}
+
+/**
+Add a source of objects whose `IMemoryFootprint` counts toward `payloadBytes`.
+
+- parameter source: returns the objects, or nil once the source is gone
+*/
+- (void)addPayloadSource:(NSArray * _Nullable (^)(void))source {
+    @synchronized (self.payloadSources) {
+        [self.payloadSources addObject:[source copy]];
+    }
+}
+
+/**
+The `memoryFootprint` of the objects of every payload source.
+
+Sources that are gone are dropped. The objects are collected under
+the lock and measured outside it.
+
+- returns: the payload in bytes
+*/
+- (NSUInteger)payloadBytes {
+    NSMutableArray *objects = [NSMutableArray array];
+    @synchronized (self.payloadSources) {
+        NSMutableIndexSet *gone = [NSMutableIndexSet indexSet];
+        [self.payloadSources enumerateObjectsUsingBlock:^(NSArray * _Nullable (^source)(void), NSUInteger index, BOOL *stop) {
+            NSArray *sourced = source();
+            if (sourced == nil) [gone addIndex:index];
+            else [objects addObjectsFromArray:sourced];
+        }];
+        [self.payloadSources removeObjectsAtIndexes:gone];
+    }
+
+    NSUInteger total = 0;
+    for (id object in objects) {
+        if ([object conformsToProtocol:@protocol(IMemoryFootprint)]) total += [(id<IMemoryFootprint>)object memoryFootprint];
+    }
+    return total;
+}
+
+/**
+The account as a JSON-compatible dictionary.
+
+- returns: the report
+*/
+- (NSDictionary<NSString *, id> *)report {
+    NSMutableDictionary<NSString *, NSDictionary *> *categories = [NSMutableDictionary dictionaryWithCapacity:MemoryCategoryCount];
+    for (MemoryCategory category = 0; category < MemoryCategoryCount; category++) {
+        categories[categoryName(category)] = @{
+            @"allocations": @([self allocationsInCategory:category]),
+            @"allocated_bytes": @([self allocatedBytesInCategory:category]),
+            @"live_bytes": @([self liveBytesInCategory:category])
+        };
+    }
+    return @{
+        @"key": self.multitonKey,
+        @"allocations": @(self.allocations),
+        @"allocated_bytes": @(self.allocatedBytes),
+        @"live_bytes": @(self.liveBytes),
+        @"payload_bytes": @(self.payloadBytes),
+        @"categories": categories
+    };
+}
+
+/**
+Clear the allocation counts and cumulative bytes.
+*/
+- (void)reset {
+    for (size_t i = 0; i < MemoryCategoryCount; i++) {
+        atomic_store_explicit(&_counters[i].allocations, 0, memory_order_relaxed);
+        atomic_store_explicit(&_counters[i].allocatedBytes, 0, memory_order_relaxed);
+    }
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@ key=%@ allocations=%llu live=%lld>", NSStringFromClass([self class]), self.multitonKey,
+            (unsigned long long)self.allocations, (long long)self.liveBytes];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -9,6 +9,16 @@
 #import <Foundation/Foundation.h>
 #import "Model.h"
 #import "IProxy.h"
+#import "IMemoryFootprint.h"
+#import "ISnapshotProxy.h"
+#import "Handle.h"
+#import "IAsyncProxy.h"
+#import "View.h"
+#import "Notification.h"
+#import "MultitonRegistry.h"
+#import "MemoryAccount.h"
+#import "MapLock.h"
+#import "Probes.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -20,18 +30,65 @@ NS_ASSUME_NONNULL_BEGIN
 /// Mapping of proxy names to their registered `IProxy` instances.
 @property (nonatomic, strong) NSMutableDictionary<NSString *, id<IProxy>> *proxyMap;
 
-/// Queue for synchronizing access to `proxyMap`.
-@property (nonatomic, strong) dispatch_queue_t proxyMapQueue;
+/// Mapping of proxy names to factories that lazily create their `IProxy` instances.
+@property (nonatomic, strong) NSMutableDictionary<NSString *, id<IProxy> (^)(void)> *proxyFactoryMap;
+
+/// Mapping of proxy names to snapshot data not yet restored into a registered `ISnapshotProxy`.
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSData *> *snapshotMap;
+
+/// Mapping of proxy names to the handles tracking them.
+@property (nonatomic, strong) NSMutableDictionary<NSString *, Handle *> *handleMap;
+
+/// Mapping of proxy names to the dispatch group of their in-flight `IAsyncProxy` load.
+@property (nonatomic, strong) NSMutableDictionary<NSString *, dispatch_group_t> *loadGroupMap;
+
+/// Mapping of proxy names to their `ProxyReadiness`, absent when ready.
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *readinessMap;
+
+/// Lock synchronizing access to the proxy, factory, snapshot, handle and readiness maps.
+@property (nonatomic, strong) id<IMapLock> proxyMapLock;
+
+/// Names of registered `IMemoryFootprint` proxies, least recently retrieved first.
+/// Also guards the cache statistics.
+@property (nonatomic, strong) NSMutableOrderedSet<NSString *> *recentProxyNames;
+
+/// Memory attributed to this Core, created on first use.
+@property (nonatomic, strong, readonly) MemoryAccount *memoryAccount;
+
+/// Storage of `memoryAccount`, nil until first use.
+@property (atomic, strong, nullable) MemoryAccount *account;
 
 @end
 
+/// Snapshot file magic, "PMVS".
+static const uint32_t SnapshotMagic = 0x53564D50;
+
+/// Snapshot file format version.
+static const uint32_t SnapshotVersion = 1;
+
+/// Snapshot file header: magic, version, entry count, reserved.
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+} SnapshotHeader;
+
+/// Snapshot index entry, locating a proxy name and its data within the file.
+typedef struct {
+    uint64_t nameOffset;
+    uint64_t nameLength;
+    uint64_t dataOffset;
+    uint64_t dataLength;
+} SnapshotEntry;
+
 /// Global map storing `Model` instances by multiton key.
-static NSMutableDictionary<NSString *, id<IModel>> *instanceMap = nil;
+static MultitonRegistry<id<IModel>> *instanceMap = nil;
 
 /// Initializes the global `instanceMap` once per process.
 __attribute__((constructor))
 static void initialize(void) {
-    instanceMap = [NSMutableDictionary dictionary];
+    instanceMap = [MultitonRegistry registry];
 }
 
 /**
@@ -57,6 +114,12 @@ actors.
 */
 @implementation Model
 
+/// Name of the notification sent when an `IAsyncProxy` finishes loading.
++ (NSString *)PROXY_READY { return @"ProxyReady"; }
+
+/// Name of the notification sent when an `IAsyncProxy` fails to load.
++ (NSString *)PROXY_FAILED { return @"ProxyFailed"; }
+
 /**
 `Model` Multiton Factory method.
 
@@ -65,23 +128,19 @@ actors.
 - returns: the instance returned by the passed closure
 */
 + (id<IModel>)getInstance:(NSString *)key factory:(id<IModel> (^)(NSString *key))factory {
-    @synchronized (instanceMap) {
-        if (instanceMap[key] == nil) {
-            instanceMap[key] = factory(key);
-        }
-        return instanceMap[key];
-    }
+    return [instanceMap objectForKey:key factory:factory];
 }
 
 /**
 Remove an IModel instance
 
+Every `IProxy` registered with a `Model` is removed with it.
+
 - parameter key: of IModel instance to remove
 */
 + (void)removeModel:(NSString *)key {
-    @synchronized (instanceMap) {
-        [instanceMap removeObjectForKey:key];
-    }
+    id<IModel> model = [instanceMap removeObjectForKey:key];
+    if ([(id)model isKindOfClass:[Model class]]) [(Model *)model removeAllProxies];
 }
 
 /**
@@ -110,7 +169,7 @@ Factory method `Model.getInstance( multitonKey )`
 */
 - (instancetype)initWithKey:(NSString *)key {
     // The Multiton Model instanceMap
-    if (instanceMap[key] != nil) {
+    if ([instanceMap objectForKey:key] != nil) {
         // Message constant
         [NSException raise:@"ModelAlreadyExistsException" format:@"A Model instance already exists for key '%@'.", key];
     }
@@ -121,71 +180,730 @@ Factory method `Model.getInstance( multitonKey )`
         // Mapping of proxyNames to IProxy instances
         _proxyMap = [NSMutableDictionary dictionary];
         
-        // Concurrent queue for proxyMap
+        // Mapping of proxyNames to factories for lazily registered IProxy instances
+        _proxyFactoryMap = [NSMutableDictionary dictionary];
+        
+        // Mapping of proxyNames to snapshot data awaiting restoration
+        _snapshotMap = [NSMutableDictionary dictionary];
+        
+        // Mapping of proxyNames to handles
+        _handleMap = [NSMutableDictionary dictionary];
+        
+        // Mappings of proxyNames to in-flight loads and their readiness
+        _loadGroupMap = [NSMutableDictionary dictionary];
+        _readinessMap = [NSMutableDictionary dictionary];
+        
+        // Loads of independent proxies run concurrently
+        _loadQueue = dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0);
+        
+        // Lock for proxyMap, with the Core's MapLockStrategy
         // for speed and convenience of running concurrently while reading, and thread safety of blocking while mutating
-        _proxyMapQueue = dispatch_queue_create("org.puremvc.model.proxyMapQueue", DISPATCH_QUEUE_CONCURRENT);
+        _proxyMapLock = [MapLock lockForCore:key label:@"org.puremvc.model.proxyMapQueue"];
+        
+        // Retrieval order of proxies that report their memory footprint
+        _recentProxyNames = [NSMutableOrderedSet orderedSet];
+        
+        // Memory attributed to this Core, created now only while MemoryAccount is enabled
+        if (MemoryAccountingActive()) [self memoryAccount];
     }
     return self;
 }
 
+/**
+Constructor seeding the Proxy factories.
+
+- parameter key: multitonKey
+- parameter proxyFactories: factories keyed by Proxy name, invoked on first retrieval
+
+@throws Error if instance for this Multiton key instance has already been constructed
+*/
+- (instancetype)initWithKey:(NSString *)key proxyFactories:(NSDictionary<NSString *, id<IProxy> (^)(void)> *)proxyFactories {
+    if (self = [self initWithKey:key]) {
+        _proxyFactoryMap = [proxyFactories mutableCopy];
+        if (MemoryAccountingActive()) [self.memoryAccount recordAllocation:MemoryCategoryMap bytes:proxyFactories.count * MemoryAccountEntrySize];
+    }
+    return self;
+}
+
+/**
+The `MemoryAccount` of this Core, created on first use so that Cores
+never accounted for do not register one. The proxies are added as its
+payload.
+
+- returns: the account shared with the Core's other actors
+*/
+- (MemoryAccount *)memoryAccount {
+    MemoryAccount *account = self.account;
+    if (account != nil) return account;
+    @synchronized (self) {
+        if (self.account == nil) {
+            account = [MemoryAccount getInstance:self.multitonKey];
+            __weak Model *weakSelf = self;
+            [account addPayloadSource:^NSArray * _Nullable { return weakSelf.proxies; }];
+            self.account = account;
+        }
+    }
+    return self.account;
+}
+
+/**
+A snapshot of the registered `IProxy` instances.
+
+- returns: the registered proxies
+*/
+- (NSArray<id<IProxy>> *)proxies {
+    __block NSArray<id<IProxy>> *proxies = nil;
+    [self.proxyMapLock read:^{
+        proxies = [self.proxyMap allValues];
+    }];
+    return proxies;
+}
+
+/**
+A snapshot of the registered Proxy factories.
+
+- returns: the factories keyed by Proxy name
+*/
+- (NSDictionary<NSString *, id<IProxy> (^)(void)> *)proxyFactories {
+    __block NSDictionary<NSString *, id<IProxy> (^)(void)> *factories = nil;
+    [self.proxyMapLock read:^{
+        factories = [self.proxyFactoryMap copy];
+    }];
+    return factories;
+}
+
 /**
 Register an `IProxy` with the `Model`.
 
 - parameter proxy: an `IProxy` to be held by the `Model`.
 */
 - (void)registerProxy:(id<IProxy>)proxy {
-    // [proxy initializeNotifier(multitonKey)]
-    dispatch_barrier_sync(self.proxyMapQueue, ^{
+    [proxy initializeNotifier:self.multitonKey];
+    __block NSData *snapshot = nil;
+    __block BOOL added = NO;
+    BOOL restorable = [(id)proxy conformsToProtocol:@protocol(ISnapshotProxy)];
+    [self.proxyMapLock write:^{
+        added = self.proxyMap[[proxy name]] == nil;
         self.proxyMap[[proxy name]] = proxy;
-    });
+        [self.handleMap[[proxy name]] updateTarget:proxy];
+        if (restorable && self.snapshotMap.count > 0) {
+            snapshot = self.snapshotMap[[proxy name]];
+            [self.snapshotMap removeObjectForKey:[proxy name]];
+        }
+    }];
+    
+    if (snapshot != nil) {
+        [(id<ISnapshotProxy>)proxy restoreSnapshotData:snapshot];
+    }
+    
+    if (added && MemoryAccountingActive()) [self.memoryAccount recordAllocation:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+    
+    if ([(id)proxy conformsToProtocol:@protocol(IMemoryFootprint)]) {
+        [self touchProxy:proxy.name];
+    }
+    PUREMVC_PROBE2(proxy_register, self.multitonKey.UTF8String, proxy.name.UTF8String);
     [proxy onRegister];
+    
+    if ([(id)proxy conformsToProtocol:@protocol(IAsyncProxy)]) {
+        [self loadProxy:(id<IAsyncProxy>)proxy];
+    }
+    
+    // the footprint is typically known once onRegister has loaded the data
+    if (self.memoryBudget > 0) [self enforceMemoryBudget];
+}
+
+/**
+Register a factory that lazily creates an `IProxy` with the `Model`.
+
+The factory is not invoked until the first time `proxyName`
+is retrieved, at which point the `IProxy` is created,
+registered and has its `onRegister` method called.
+
+- parameter factory: closure that returns the `IProxy` instance
+- parameter proxyName: the name the `IProxy` will be registered under
+*/
+- (void)registerProxyFactory:(id<IProxy> (^)(void))factory name:(NSString *)proxyName {
+    __block BOOL added = NO;
+    [self.proxyMapLock write:^{
+        added = self.proxyFactoryMap[proxyName] == nil;
+        self.proxyFactoryMap[proxyName] = [factory copy];
+    }];
+    if (added && MemoryAccountingActive()) [self.memoryAccount recordAllocation:MemoryCategoryMap bytes:MemoryAccountEntrySize];
 }
 
 /**
 Retrieve an `IProxy` from the `Model`.
 
+If the `IProxy` was registered with a factory and has not
+been created yet, it is created and registered first.
+
 - parameter proxyName:
 - returns: the `IProxy` instance previously registered with the given `proxyName`.
 */
 - (nullable id<IProxy>)retrieveProxy:(NSString *)proxyName {
     __block id<IProxy> proxy = nil;
-    dispatch_sync(self.proxyMapQueue, ^{
+    __block id<IProxy> (^factory)(void) = nil;
+    [self.proxyMapLock read:^{
         proxy = self.proxyMap[proxyName];
-    });
-    return proxy;
+        if (proxy == nil) factory = self.proxyFactoryMap[proxyName];
+    }];
+    
+    if (proxy != nil) {
+        if (self.memoryBudget > 0) {
+            @synchronized (self.recentProxyNames) {
+                _cacheHits++;
+            }
+            if ([(id)proxy conformsToProtocol:@protocol(IMemoryFootprint)]) [self touchProxy:proxyName];
+        }
+        return proxy;
+    }
+    
+    if (factory == nil) return nil;
+    return [self instantiateProxy:proxyName factory:factory];
+}
+
+/**
+Retrieve a handle that tracks the `IProxy` registered under a name.
+
+The handle is created on first request and kept current by
+`registerProxy:` and `removeProxy:`. When it holds nothing, it
+falls back to `retrieveProxy:`, so factory registered and evicted
+proxies are created on access.
+
+- parameter proxyName: the name of the `IProxy` to track
+- returns: the handle for `proxyName`
+*/
+- (id<IHandle>)retrieveProxyHandle:(NSString *)proxyName {
+    __block Handle *handle = nil;
+    __weak Model *weakSelf = self;
+    [self.proxyMapLock write:^{
+        handle = self.handleMap[proxyName];
+        if (handle == nil) {
+            handle = [Handle withName:proxyName resolver:^id (NSString *name) { return [weakSelf retrieveProxy:name]; }];
+            [handle updateTarget:self.proxyMap[proxyName]];
+            self.handleMap[proxyName] = handle;
+        }
+    }];
+    return handle;
+}
+
+/**
+Create and register an `IProxy` from its factory.
+
+Construction is serialized on the factory, so threads racing on
+the first retrieval wait for a single instance to be created and
+registered, then all return that same instance.
+
+- parameter proxyName: the name the `IProxy` is registered under
+- parameter factory: closure that returns the `IProxy` instance
+- returns: the registered `IProxy`, or nil if the factory was removed meanwhile
+*/
+- (nullable id<IProxy>)instantiateProxy:(NSString *)proxyName factory:(id<IProxy> (^)(void))factory {
+    @synchronized (factory) {
+        __block id<IProxy> proxy = nil;
+        __block BOOL registered = NO;
+        [self.proxyMapLock read:^{
+            proxy = self.proxyMap[proxyName];
+            registered = self.proxyFactoryMap[proxyName] == factory;
+        }];
+        
+        // another thread won the race, or the factory was removed or replaced
+        if (proxy != nil || !registered) return proxy;
+        
+        if (self.memoryBudget > 0) {
+            @synchronized (self.recentProxyNames) {
+                _cacheMisses++;
+            }
+        }
+        
+        proxy = factory();
+        [self registerProxy:proxy];
+        return proxy;
+    }
 }
 
 /**
 Check if a Proxy is registered
 
 - parameter proxyName:
-- returns: whether a Proxy is currently registered with the given `proxyName`.
+- returns: whether a Proxy or Proxy factory is currently registered with the given `proxyName`.
 */
 - (BOOL)hasProxy:(NSString *)proxyName {
     __block BOOL exists = NO;
-    dispatch_sync(self.proxyMapQueue, ^{
-         exists = self.proxyMap[proxyName] != nil;
-    });
+    [self.proxyMapLock read:^{
+         exists = self.proxyMap[proxyName] != nil || self.proxyFactoryMap[proxyName] != nil;
+    }];
     return exists;
 }
 
 /**
 Remove an `IProxy` from the `Model`.
 
+Any factory registered for `proxyName` is removed as well.
+
 - parameter proxyName: name of the `IProxy` instance to be removed.
-- returns: the `IProxy` that was removed from the `Model`
+- returns: the `IProxy` that was removed from the `Model`, or nil if it was never created
 */
 - (nullable id<IProxy>)removeProxy:(NSString *)proxyName {
     __block id<IProxy> proxy = nil;
-    dispatch_barrier_sync(self.proxyMapQueue, ^{
+    __block NSUInteger entries = 0;
+    [self.proxyMapLock write:^{
         proxy = self.proxyMap[proxyName];
+        entries = (proxy != nil ? 1 : 0) + (self.proxyFactoryMap[proxyName] != nil ? 1 : 0);
         self.proxyMap[proxyName] = nil;
-    });
+        self.proxyFactoryMap[proxyName] = nil;
+        [self.handleMap[proxyName] updateTarget:nil];
+        [self.readinessMap removeObjectForKey:proxyName];
+    }];
     
+    @synchronized (self.recentProxyNames) {
+        [self.recentProxyNames removeObject:proxyName];
+    }
+    
+    if (entries > 0 && MemoryAccountingActive()) [self.memoryAccount recordRelease:MemoryCategoryMap bytes:entries * MemoryAccountEntrySize];
+    
+    if (proxy != nil) PUREMVC_PROBE2(proxy_remove, self.multitonKey.UTF8String, proxyName.UTF8String);
     [proxy onRemove];
     return proxy;
 }
 
-@end
+/**
+Remove every `IProxy` from the `Model`.
+
+All maps are swapped out in a single barrier, then each removed
+`IProxy` has its `onRemove` method called outside the queue.
+
+- returns: the proxies that were removed
+*/
+- (NSArray<id<IProxy>> *)removeAllProxies {
+    __block NSDictionary<NSString *, id<IProxy>> *proxies = nil;
+    __block NSDictionary<NSString *, Handle *> *handles = nil;
+    __block NSUInteger factories = 0;
+    [self.proxyMapLock write:^{
+        proxies = self.proxyMap;
+        handles = self.handleMap;
+        factories = self.proxyFactoryMap.count;
+        self.proxyMap = [NSMutableDictionary dictionary];
+        self.proxyFactoryMap = [NSMutableDictionary dictionary];
+        self.snapshotMap = [NSMutableDictionary dictionary];
+        self.handleMap = [NSMutableDictionary dictionary];
+        self.loadGroupMap = [NSMutableDictionary dictionary];
+        self.readinessMap = [NSMutableDictionary dictionary];
+    }];
+    
+    @synchronized (self.recentProxyNames) {
+        [self.recentProxyNames removeAllObjects];
+    }
+    
+    if (MemoryAccountingActive()) [self.memoryAccount recordRelease:MemoryCategoryMap bytes:(proxies.count + factories) * MemoryAccountEntrySize];
+    
+    for (Handle *handle in [handles objectEnumerator]) {
+        [handle updateTarget:nil];
+    }
+    
+    NSArray<id<IProxy>> *removed = [proxies allValues];
+    for (id<IProxy> proxy in removed) {
+        PUREMVC_PROBE2(proxy_remove, self.multitonKey.UTF8String, proxy.name.UTF8String);
+        [proxy onRemove];
+    }
+    return removed;
+}
+
+/**
+Set the memory budget, evicting proxies right away if it is exceeded.
 
-NS_ASSUME_NONNULL_END
+- parameter memoryBudget: the budget in bytes, or 0 to disable budget mode
+*/
+- (void)setMemoryBudget:(NSUInteger)memoryBudget {
+    _memoryBudget = memoryBudget;
+    if (memoryBudget > 0) [self enforceMemoryBudget];
+}
+
+/**
+Reset the hit, miss and eviction counters to zero.
+*/
+- (void)resetCacheStatistics {
+    @synchronized (self.recentProxyNames) {
+        _cacheHits = 0;
+        _cacheMisses = 0;
+        _cacheEvictions = 0;
+    }
+}
+
+/**
+Mark a Proxy as the most recently retrieved.
+
+- parameter proxyName: the name of the Proxy
+*/
+- (void)touchProxy:(NSString *)proxyName {
+    @synchronized (self.recentProxyNames) {
+        [self.recentProxyNames removeObject:proxyName];
+        [self.recentProxyNames addObject:proxyName];
+    }
+}
+
+/**
+Evict the least recently retrieved proxies until the combined
+footprint of `IMemoryFootprint` proxies fits `memoryBudget`.
+
+Only proxies with a registered factory are evicted, since they
+can be recreated on their next retrieval. The most recently
+retrieved Proxy is never evicted.
+*/
+- (void)enforceMemoryBudget {
+    NSUInteger budget = self.memoryBudget;
+    NSMutableArray<id<IProxy>> *evicted = [NSMutableArray array];
+    
+    // serialize enforcement so concurrent callers don't over-evict
+    @synchronized (self.recentProxyNames) {
+        NSArray<NSString *> *names = [[self.recentProxyNames array] copy];
+        NSMutableArray<id<IProxy>> *proxies = [NSMutableArray arrayWithCapacity:names.count];
+        NSMutableIndexSet *evictable = [NSMutableIndexSet indexSet];
+        
+        [self.proxyMapLock read:^{
+            for (NSString *name in names) {
+                id<IProxy> proxy = self.proxyMap[name];
+                if (![(id)proxy conformsToProtocol:@protocol(IMemoryFootprint)]) continue;
+                if (self.proxyFactoryMap[name] != nil && name != names.lastObject) {
+                    [evictable addIndex:proxies.count];
+                }
+                [proxies addObject:proxy];
+            }
+        }];
+        
+        // footprints are computed outside the queue, they may call back into the Model
+        NSUInteger footprint = 0;
+        NSMutableArray<NSNumber *> *sizes = [NSMutableArray arrayWithCapacity:proxies.count];
+        for (id<IProxy> proxy in proxies) {
+            NSUInteger size = [(id<IMemoryFootprint>)proxy memoryFootprint];
+            [sizes addObject:@(size)];
+            footprint += size;
+        }
+        
+        NSUInteger index = [evictable firstIndex];
+        while (footprint > budget && index != NSNotFound) {
+            id<IProxy> proxy = proxies[index];
+            __block BOOL removed = NO;
+            [self.proxyMapLock write:^{
+                // skip proxies that were removed or replaced meanwhile
+                if (self.proxyMap[proxy.name] == proxy && self.proxyFactoryMap[proxy.name] != nil) {
+                    [self.proxyMap removeObjectForKey:proxy.name];
+                    [self.handleMap[proxy.name] updateTarget:nil];
+                    removed = YES;
+                }
+            }];
+            
+            if (removed) {
+                if (MemoryAccountingActive()) [self.memoryAccount recordRelease:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+                [self.recentProxyNames removeObject:proxy.name];
+                [evicted addObject:proxy];
+                footprint -= [sizes[index] unsignedIntegerValue];
+                _cacheEvictions++;
+            }
+            index = [evictable indexGreaterThanIndex:index];
+        }
+    }
+    
+    for (id<IProxy> proxy in evicted) {
+        PUREMVC_PROBE2(proxy_remove, self.multitonKey.UTF8String, proxy.name.UTF8String);
+        [proxy onRemove];
+    }
+}
+
+/**
+Write the data of every registered `ISnapshotProxy` to a binary snapshot file.
+
+The file holds a `SnapshotHeader`, followed by one `SnapshotEntry`
+per proxy, followed by the names and data they point to. Data is
+8-byte aligned and every integer is little-endian.
+
+- parameter url: the file URL to write the snapshot to
+- parameter error: on failure, the reason the snapshot could not be written
+- returns: YES if the snapshot was written
+*/
+- (BOOL)writeSnapshotToURL:(NSURL *)url error:(NSError **)error {
+    __block NSArray<id<IProxy>> *proxies = nil;
+    __block NSMutableDictionary<NSString *, NSData *> *entries = nil;
+    [self.proxyMapLock read:^{
+        proxies = [self.proxyMap allValues];
+        entries = [self.snapshotMap mutableCopy];
+    }];
+    
+    // snapshot data is encoded outside the queue, proxies may call back into the Model
+    for (id<IProxy> proxy in proxies) {
+        if (![(id)proxy conformsToProtocol:@protocol(ISnapshotProxy)]) continue;
+        NSData *data = [(id<ISnapshotProxy>)proxy snapshotData];
+        if (data != nil) entries[proxy.name] = data;
+    }
+    
+    NSArray<NSString *> *names = [[entries allKeys] sortedArrayUsingSelector:@selector(compare:)];
+    uint64_t offset = sizeof(SnapshotHeader) + names.count * sizeof(SnapshotEntry);
+    NSMutableData *index = [NSMutableData dataWithCapacity:offset];
+    NSMutableData *blobs = [NSMutableData data];
+    
+    SnapshotHeader header = {
+        NSSwapHostIntToLittle(SnapshotMagic),
+        NSSwapHostIntToLittle(SnapshotVersion),
+        NSSwapHostIntToLittle((uint32_t)names.count),
+        0
+    };
+    [index appendBytes:&header length:sizeof(header)];
+    
+    for (NSString *name in names) {
+        NSData *nameData = [name dataUsingEncoding:NSUTF8StringEncoding];
+        NSData *data = entries[name];
+        SnapshotEntry entry;
+        
+        entry.nameOffset = NSSwapHostLongLongToLittle(offset + blobs.length);
+        entry.nameLength = NSSwapHostLongLongToLittle(nameData.length);
+        [blobs appendData:nameData];
+        [blobs increaseLengthBy:(8 - (offset + blobs.length) % 8) % 8];
+        
+        entry.dataOffset = NSSwapHostLongLongToLittle(offset + blobs.length);
+        entry.dataLength = NSSwapHostLongLongToLittle(data.length);
+        [blobs appendData:data];
+        [blobs increaseLengthBy:(8 - (offset + blobs.length) % 8) % 8];
+        
+        [index appendBytes:&entry length:sizeof(entry)];
+    }
+    
+    [index appendData:blobs];
+    return [index writeToURL:url options:NSDataWritingAtomic error:error];
+}
+
+/**
+Memory-map a snapshot file previously written by `writeSnapshotToURL:error:`.
+
+Only the index is read here. Each entry becomes a no-copy slice of the
+mapping, which keeps the file mapped for as long as any slice is alive.
+
+- parameter url: the file URL of the snapshot
+- parameter error: on failure, the reason the snapshot could not be loaded
+- returns: YES if the snapshot was mapped and its index is valid
+*/
+- (BOOL)loadSnapshotFromURL:(NSURL *)url error:(NSError **)error {
+    NSData *file = [NSData dataWithContentsOfURL:url options:NSDataReadingMappedAlways error:error];
+    if (file == nil) return NO;
+    
+    const uint8_t *bytes = file.bytes;
+    uint64_t length = file.length;
+    SnapshotHeader header;
+    if (length < sizeof(header)) return [self snapshotError:error url:url];
+    memcpy(&header, bytes, sizeof(header));
+    
+    uint64_t count = NSSwapLittleIntToHost(header.count);
+    if (NSSwapLittleIntToHost(header.magic) != SnapshotMagic ||
+        NSSwapLittleIntToHost(header.version) != SnapshotVersion ||
+        count > (length - sizeof(header)) / sizeof(SnapshotEntry)) {
+        return [self snapshotError:error url:url];
+    }
+    
+    NSMutableDictionary<NSString *, NSData *> *entries = [NSMutableDictionary dictionaryWithCapacity:count];
+    for (uint64_t i = 0; i < count; i++) {
+        SnapshotEntry entry;
+        memcpy(&entry, bytes + sizeof(header) + i * sizeof(entry), sizeof(entry));
+        uint64_t nameOffset = NSSwapLittleLongLongToHost(entry.nameOffset);
+        uint64_t nameLength = NSSwapLittleLongLongToHost(entry.nameLength);
+        uint64_t dataOffset = NSSwapLittleLongLongToHost(entry.dataOffset);
+        uint64_t dataLength = NSSwapLittleLongLongToHost(entry.dataLength);
+        if (nameOffset > length || nameLength > length - nameOffset ||
+            dataOffset > length || dataLength > length - dataOffset) {
+            return [self snapshotError:error url:url];
+        }
+        
+        NSString *name = [[NSString alloc] initWithBytes:bytes + nameOffset length:nameLength encoding:NSUTF8StringEncoding];
+        if (name == nil) return [self snapshotError:error url:url];
+        
+        // the deallocator captures the mapping, unmapping it once the last slice is released
+        entries[name] = [[NSData alloc] initWithBytesNoCopy:(void *)(bytes + dataOffset) length:dataLength deallocator:^(void *slice, NSUInteger sliceLength) {
+            (void)file;
+        }];
+    }
+    
+    [self.proxyMapLock write:^{
+        [self.snapshotMap addEntriesFromDictionary:entries];
+    }];
+    return YES;
+}
+
+/**
+Report a snapshot file that is truncated or not in the expected format.
+
+- parameter error: receives the error, if not NULL
+- parameter url: the snapshot file URL
+- returns: NO, for convenience
+*/
+- (BOOL)snapshotError:(NSError **)error url:(NSURL *)url {
+    if (error != NULL) {
+        *error = [NSError errorWithDomain:@"org.puremvc.model" code:1 userInfo:@{
+            NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Invalid Model snapshot file '%@'.", url.path],
+            NSURLErrorKey: url
+        }];
+    }
+    return NO;
+}
+
+/**
+Start loading an `IAsyncProxy` on the load queue.
+
+The Proxy is marked as loading before this method returns. When
+the load completes, its readiness is updated and `PROXY_READY` or
+`PROXY_FAILED` is sent, unless the Proxy was removed or replaced
+in the meantime.
+
+- parameter proxy: the registered `IAsyncProxy`
+*/
+- (void)loadProxy:(id<IAsyncProxy>)proxy {
+    NSString *proxyName = proxy.name;
+    dispatch_group_t group = dispatch_group_create();
+    dispatch_group_enter(group);
+    [self.proxyMapLock write:^{
+        self.loadGroupMap[proxyName] = group;
+        self.readinessMap[proxyName] = @(ProxyReadinessLoading);
+    }];
+    
+    dispatch_async(self.loadQueue, ^{
+        [proxy loadWithCompletion:^(NSError * _Nullable error) {
+            __block BOOL current = NO;
+            [self.proxyMapLock write:^{
+                current = self.proxyMap[proxyName] == proxy;
+                if (self.loadGroupMap[proxyName] == group) [self.loadGroupMap removeObjectForKey:proxyName];
+                if (!current) return;
+                if (error == nil) {
+                    [self.readinessMap removeObjectForKey:proxyName];
+                } else {
+                    self.readinessMap[proxyName] = @(ProxyReadinessFailed);
+                }
+            }];
+            
+            // a Core removed while loading has no View, and none is created for it
+            id<IView> view = current ? [View viewForKey:self.multitonKey] : nil;
+            if (view != nil) {
+                if (error == nil) {
+                    [view notifyObservers:[Notification withName:[Model PROXY_READY] body:proxy type:proxyName]];
+                } else {
+                    [view notifyObservers:[Notification withName:[Model PROXY_FAILED] body:error type:proxyName]];
+                }
+            }
+            dispatch_group_leave(group);
+        }];
+    });
+}
+
+/**
+Get the loading state of an `IProxy`.
+
+- parameter proxyName: the name of the `IProxy`
+- returns: the `ProxyReadiness` of the `IProxy`
+*/
+- (ProxyReadiness)proxyReadiness:(NSString *)proxyName {
+    __block ProxyReadiness readiness = ProxyReadinessReady;
+    [self.proxyMapLock read:^{
+        readiness = [self.readinessMap[proxyName] integerValue];
+    }];
+    return readiness;
+}
+
+/**
+Collect the in-flight loads for a set of proxies.
+
+Factory registered proxies are retrieved first, which creates
+them and starts their load.
+
+- parameter proxyNames: the names of the proxies
+- returns: the dispatch groups of the loads still in flight
+*/
+- (NSArray<dispatch_group_t> *)loadGroupsForProxies:(NSArray<NSString *> *)proxyNames {
+    for (NSString *proxyName in proxyNames) {
+        [self retrieveProxy:proxyName];
+    }
+    
+    NSMutableArray<dispatch_group_t> *groups = [NSMutableArray arrayWithCapacity:proxyNames.count];
+    [self.proxyMapLock read:^{
+        for (NSString *proxyName in proxyNames) {
+            dispatch_group_t group = self.loadGroupMap[proxyName];
+            if (group != nil) [groups addObject:group];
+        }
+    }];
+    return groups;
+}
+
+/**
+Wait, without blocking, for a set of proxies to finish loading.
+
+- parameter proxyNames: the names of the proxies to wait for
+- parameter completion: called on the load queue once all of them have finished loading
+*/
+- (void)awaitProxies:(NSArray<NSString *> *)proxyNames completion:(void (^)(void))completion {
+    dispatch_group_t all = dispatch_group_create();
+    for (dispatch_group_t group in [self loadGroupsForProxies:proxyNames]) {
+        dispatch_group_enter(all);
+        dispatch_group_notify(group, self.loadQueue, ^{
+            dispatch_group_leave(all);
+        });
+    }
+    dispatch_group_notify(all, self.loadQueue, completion);
+}
+
+/**
+Block the calling thread until a set of proxies have finished loading.
+
+- parameter proxyNames: the names of the proxies to wait for
+- parameter timeout: the maximum number of seconds to wait
+- returns: YES if every Proxy finished loading before the timeout
+*/
+- (BOOL)waitForProxies:(NSArray<NSString *> *)proxyNames timeout:(NSTimeInterval)timeout {
+    dispatch_time_t deadline = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeout * NSEC_PER_SEC));
+    for (dispatch_group_t group in [self loadGroupsForProxies:proxyNames]) {
+        if (dispatch_group_wait(group, deadline) != 0) return NO;
+    }
+    return YES;
+}
+
+
+/**
+Take a snapshot of the `Model`'s registrations, for diagnostics.
+
+The proxy, factory, snapshot and readiness maps are copied in a
+single read, and described outside the queue.
+
+- returns: the registrations, serializable with `NSJSONSerialization`
+*/
+- (NSDictionary<NSString *, id> *)introspect {
+    __block NSDictionary<NSString *, id<IProxy>> *proxies = nil;
+    __block NSArray<NSString *> *factories = nil;
+    __block NSArray<NSString *> *snapshots = nil;
+    __block NSDictionary<NSString *, NSNumber *> *readiness = nil;
+    [self.proxyMapLock read:^{
+        proxies = [self.proxyMap copy];
+        factories = [self.proxyFactoryMap allKeys];
+        snapshots = [self.snapshotMap allKeys];
+        readiness = [self.readinessMap copy];
+    }];
+    
+    NSMutableArray<NSDictionary *> *proxyList = [NSMutableArray arrayWithCapacity:proxies.count];
+    for (NSString *name in [proxies.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+        NSString *state = @"ready";
+        switch ((ProxyReadiness)[readiness[name] integerValue]) {
+            case ProxyReadinessLoading: state = @"loading"; break;
+            case ProxyReadinessFailed: state = @"failed"; break;
+            case ProxyReadinessReady: break;
+        }
+        [proxyList addObject:@{@"name": name, @"class": NSStringFromClass([(id)proxies[name] class]), @"readiness": state}];
+    }
+    
+    // factories whose Proxy was created are reported with the proxies
+    NSMutableArray<NSString *> *pending = [NSMutableArray arrayWithCapacity:factories.count];
+    for (NSString *name in factories) {
+        if (proxies[name] == nil) [pending addObject:name];
+    }
+    
+    return @{
+        @"key": self.multitonKey,
+        @"proxies": proxyList,
+        @"factories": [pending sortedArrayUsingSelector:@selector(compare:)],
+        @"snapshots": [snapshots sortedArrayUsingSelector:@selector(compare:)]
+    };
+}
+
+@end
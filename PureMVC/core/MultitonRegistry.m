@@ -0,0 +1,162 @@
+//
+//  MultitonRegistry.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <pthread.h>
+#import "MultitonRegistry.h"
+#import "VersionedReference.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Number of independently locked shards.
+#define ShardCount 32
+
+/**
+A concurrent map of Multiton instances by key.
+
+Each shard publishes an immutable dictionary through a
+`VersionedReference`, so lookups load the current dictionary without
+locking. Registration and removal copy the shard's dictionary, change
+the copy and publish it, holding the shard's mutex only for the copy.
+
+Factories run under a single recursive creation lock per registry, as
+`@synchronized` on the registry did, never under a shard's mutex. A
+factory may create instances in other registries, and holding a shard
+mutex across it would let two threads take two shards in opposite
+order. The creation lock is recursive because a factory typically
+registers its instance from its own initializer.
+*/
+@implementation MultitonRegistry {
+    /// The published dictionary of each shard.
+    VersionedReference<NSDictionary *> *_shards[ShardCount];
+    
+    /// Serializes registration and removal within each shard; never held while calling out.
+    pthread_mutex_t _locks[ShardCount];
+    
+    /// Serializes the factories.
+    pthread_mutex_t _creationLock;
+}
+
+/**
+ * Creates and returns a new, empty `MultitonRegistry`.
+ *
+ * @return A new `MultitonRegistry` instance.
+ */
++ (instancetype)registry {
+    return [[self alloc] init];
+}
+
+/// Constructor
+- (instancetype)init {
+    if (self = [super init]) {
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+        pthread_mutex_init(&_creationLock, &attr);
+        pthread_mutexattr_destroy(&attr);
+        for (int i = 0; i < ShardCount; i++) {
+            _shards[i] = [VersionedReference withValue:@{}];
+            pthread_mutex_init(&_locks[i], NULL);
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    for (int i = 0; i < ShardCount; i++) {
+        pthread_mutex_destroy(&_locks[i]);
+    }
+    pthread_mutex_destroy(&_creationLock);
+}
+
+/// The shard a key belongs to.
+static inline NSUInteger shardIndex(NSString *key) {
+    return key.hash % ShardCount;
+}
+
+/**
+Look up the instance for a key without taking a lock.
+
+- parameter key: the multiton key
+- returns: the instance registered for the key, or nil
+*/
+- (nullable id)objectForKey:(NSString *)key {
+    return [_shards[shardIndex(key)] load][key];
+}
+
+/**
+Look up the instance for a key, creating it if there is none.
+
+- parameter key: the multiton key
+- parameter factory: returns a new instance for the key
+- returns: the instance registered for the key
+*/
+- (id)objectForKey:(NSString *)key factory:(id (^)(NSString *key))factory {
+    NSUInteger index = shardIndex(key);
+    id object = [_shards[index] load][key];
+    if (object != nil) return object;
+    
+    pthread_mutex_lock(&_creationLock);
+    @try {
+        // another thread may have created it while we waited
+        object = [_shards[index] load][key];
+        if (object == nil) {
+            object = factory(key);
+            // initializers register themselves; only publish if they did not
+            if ([_shards[index] load][key] != object) {
+                [self setObject:object forKey:key];
+            }
+        }
+    } @finally {
+        // factories raise when an instance already exists for the key
+        pthread_mutex_unlock(&_creationLock);
+    }
+    return object;
+}
+
+/**
+Register an instance for a key, replacing any existing one.
+
+- parameter object: the instance
+- parameter key: the multiton key
+*/
+- (void)setObject:(id)object forKey:(NSString *)key {
+    NSUInteger index = shardIndex(key);
+    pthread_mutex_lock(&_locks[index]);
+    [_shards[index] update:^NSDictionary *(NSDictionary *map) {
+        NSMutableDictionary *copy = [map mutableCopy];
+        copy[key] = object;
+        return [copy copy];
+    }];
+    pthread_mutex_unlock(&_locks[index]);
+}
+
+/**
+Remove the instance for a key.
+
+- parameter key: the multiton key
+- returns: the instance that was removed, or nil
+*/
+- (nullable id)removeObjectForKey:(NSString *)key {
+    NSUInteger index = shardIndex(key);
+    pthread_mutex_lock(&_locks[index]);
+    id object = [_shards[index] load][key];
+    if (object != nil) {
+        [_shards[index] update:^NSDictionary *(NSDictionary *map) {
+            NSMutableDictionary *copy = [map mutableCopy];
+            [copy removeObjectForKey:key];
+            return [copy copy];
+        }];
+    }
+    pthread_mutex_unlock(&_locks[index]);
+    return object;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,251 @@
+//
+//  Pipe.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <stdatomic.h>
+#import <stdlib.h>
+#import "Pipe.h"
+#import "View.h"
+#import "MultitonRegistry.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A ring buffer cell; its sequence tells writers and the reader whose turn it is.
+typedef struct {
+    atomic_size_t sequence;
+    void *item;
+} PipeSlot;
+
+/// Multiton registry for storing `Pipe` instances by key.
+static MultitonRegistry<Pipe *> *instanceMap = nil;
+
+/// Initializes the global `Pipe` instance map.
+__attribute__((constructor()))
+static void initialize(void) {
+    instanceMap = [MultitonRegistry registry];
+}
+
+/**
+A bounded multi-producer, single-consumer ring buffer of notifications.
+
+Each slot carries a sequence number. A writer claims the position at
+the tail by compare-and-swap once the slot's sequence says it is free,
+stores the retained notification, and publishes it by advancing the
+sequence. The executor is the only reader: it consumes slots from the
+head while their sequence says they are published, and hands each slot
+back to the writers one lap ahead.
+
+A drain is scheduled on the executor only when the pipe goes from idle
+to busy, so a burst of writes costs a single `dispatch_async`.
+*/
+@implementation Pipe {
+    /// The ring buffer, `capacity` slots.
+    PipeSlot *_slots;
+    
+    /// `capacity - 1`, for wrapping positions into slot indexes.
+    size_t _mask;
+    
+    /// Next position to write, shared by the writers.
+    atomic_size_t _tail;
+    
+    /// Next position to read, owned by the executor.
+    size_t _head;
+    
+    /// Whether a drain is scheduled or running on the executor.
+    atomic_bool _draining;
+    
+    /// Whether the pipe has been closed.
+    atomic_bool _closed;
+}
+
+/**
+Pipe Multiton Factory method.
+
+- parameter key: multitonKey of the receiving Core
+- parameter factory: reference that returns `Pipe`
+- returns: the Multiton instance returned by executing the passed closure
+*/
++ (Pipe *)getInstance:(NSString *)key factory:(Pipe *(^)(NSString *key))factory {
+    return [instanceMap objectForKey:key factory:factory];
+}
+
+/**
+Close and remove a Pipe instance
+
+- parameter key: of Pipe instance to remove
+*/
++ (void)removePipe:(NSString *)key {
+    [[instanceMap removeObjectForKey:key] close];
+}
+
+/**
+Write a notification to the Pipe of a Core.
+
+- parameter notification: the notification to deliver
+- parameter key: multitonKey of the receiving Core
+- returns: NO if the Core has no pipe, or its pipe is full or closed
+*/
++ (BOOL)write:(id<INotification>)notification toCore:(NSString *)key {
+    Pipe *pipe = [instanceMap objectForKey:key];
+    return pipe != nil && [pipe write:notification];
+}
+
+/**
+ * Creates and returns a new `Pipe` with a capacity of 1024.
+ *
+ * @param key The multiton key of the receiving Core.
+ * @return A new `Pipe` instance.
+ */
++ (instancetype)withKey:(NSString *)key {
+    return [[Pipe alloc] initWithKey:key capacity:1024];
+}
+
+/**
+ * Creates and returns a new `Pipe`.
+ *
+ * @param key The multiton key of the receiving Core.
+ * @param capacity The number of notifications the pipe holds.
+ * @return A new `Pipe` instance.
+ */
++ (instancetype)withKey:(NSString *)key capacity:(NSUInteger)capacity {
+    return [[Pipe alloc] initWithKey:key capacity:capacity];
+}
+
+/**
+Constructor.
+
+- parameter key: multitonKey of the receiving Core
+- parameter capacity: the number of notifications the pipe holds, rounded up to a power of two
+
+@throws Error if instance for this Multiton key has already been constructed
+*/
+- (instancetype)initWithKey:(NSString *)key capacity:(NSUInteger)capacity {
+    if ([instanceMap objectForKey:key] != nil) {
+        [NSException raise:@"PipeAlreadyExistsException" format:@"A Pipe instance already exists for key '%@'.", key];
+    }
+    if (self = [super init]) {
+        _multitonKey = [key copy];
+        [instanceMap setObject:self forKey:key];
+        
+        _capacity = 2;
+        while (_capacity < capacity) _capacity <<= 1;
+        _mask = _capacity - 1;
+        
+        // each slot starts out free for the writer on the first lap
+        _slots = calloc(_capacity, sizeof(PipeSlot));
+        for (size_t i = 0; i < _capacity; i++) {
+            atomic_init(&_slots[i].sequence, i);
+        }
+        atomic_init(&_tail, 0);
+        atomic_init(&_draining, false);
+        atomic_init(&_closed, false);
+        
+        _executor = dispatch_queue_create("org.puremvc.pipe.executor", DISPATCH_QUEUE_SERIAL);
+    }
+    return self;
+}
+
+/// Releases the notifications never drained and the ring buffer.
+- (void)dealloc {
+    void *item = NULL;
+    while ((item = [self dequeue]) != NULL) {
+        (void)CFBridgingRelease(item);
+    }
+    free(_slots);
+}
+
+/**
+Write a notification to the Pipe without blocking.
+
+- parameter notification: the notification to deliver
+- returns: NO if the pipe is full or closed
+*/
+- (BOOL)write:(id<INotification>)notification {
+    if (atomic_load_explicit(&_closed, memory_order_relaxed)) return NO;
+    
+    size_t position = atomic_load_explicit(&_tail, memory_order_relaxed);
+    PipeSlot *slot = NULL;
+    while (true) {
+        slot = &_slots[position & _mask];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+        if (difference == 0) {
+            // the slot is free on this lap, claim its position
+            if (atomic_compare_exchange_weak_explicit(&_tail, &position, position + 1, memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (difference < 0) {
+            // the reader has not consumed this slot from the previous lap
+            return NO;
+        } else {
+            position = atomic_load_explicit(&_tail, memory_order_relaxed);
+        }
+    }
+    
+    slot->item = (void *)CFBridgingRetain(notification);
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+    
+    if (!atomic_exchange_explicit(&_draining, true, memory_order_acq_rel)) {
+        dispatch_async(self.executor, ^{
+            [self drain];
+        });
+    }
+    return YES;
+}
+
+/**
+Take the next published notification off the ring buffer.
+
+Only called on the executor, or from `dealloc`.
+
+- returns: the retained notification, or NULL if none is published
+*/
+- (nullable void *)dequeue {
+    PipeSlot *slot = &_slots[_head & _mask];
+    size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+    if (sequence != _head + 1) return NULL;
+    
+    void *item = slot->item;
+    slot->item = NULL;
+    // hand the slot back to the writers for the next lap
+    atomic_store_explicit(&slot->sequence, _head + _capacity, memory_order_release);
+    _head++;
+    return item;
+}
+
+/**
+Deliver every published notification to the `View` of the Core.
+
+The `View` is looked up without creating one; notifications that
+arrive while the Core has no `View` are discarded. Runs on the executor. After going idle it checks the ring buffer
+once more, in case a writer published after the last dequeue but
+saw the drain still scheduled.
+*/
+- (void)drain {
+    id<IView> view = nil;
+    do {
+        void *item = NULL;
+        while ((item = [self dequeue]) != NULL) {
+            id<INotification> notification = CFBridgingRelease(item);
+            if (atomic_load_explicit(&_closed, memory_order_relaxed)) continue;
+            if (view == nil) view = [View viewForKey:self.multitonKey];
+            [view notifyObservers:notification];
+        }
+        atomic_store_explicit(&_draining, false, memory_order_release);
+    } while (atomic_load_explicit(&_slots[_head & _mask].sequence, memory_order_acquire) == _head + 1 &&
+             !atomic_exchange_explicit(&_draining, true, memory_order_acq_rel));
+}
+
+/**
+Close the Pipe, failing later writes and discarding what is still in it.
+*/
+- (void)close {
+    atomic_store(&_closed, true);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
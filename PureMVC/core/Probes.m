@@ -0,0 +1,26 @@
+//
+//  Probes.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import "Probes.h"
+
+#if PUREMVC_PROBES
+
+/// Defines a probe's semaphore in the `.probes` section, where tracers look for it.
+#define PUREMVC_PROBE_DEFINE(probe) \
+    __attribute__((section(".probes"))) unsigned short PUREMVC_PROBE_SEMAPHORE(probe) = 0
+
+PUREMVC_PROBE_DEFINE(notify_start);
+PUREMVC_PROBE_DEFINE(notify_end);
+PUREMVC_PROBE_DEFINE(observer_invoke);
+PUREMVC_PROBE_DEFINE(command_execute);
+PUREMVC_PROBE_DEFINE(proxy_register);
+PUREMVC_PROBE_DEFINE(proxy_remove);
+PUREMVC_PROBE_DEFINE(mediator_register);
+PUREMVC_PROBE_DEFINE(mediator_remove);
+
+#endif
@@ -0,0 +1,530 @@
+//
+//  SharedMemoryTransport.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <fcntl.h>
+#import <pthread.h>
+#import <stdatomic.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <unistd.h>
+#import "SharedMemoryTransport.h"
+#import "Notification.h"
+#import "View.h"
+#import "NotificationCodec.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Segment magic, "PMVT".
+static const uint32_t TransportMagic = 0x54564D50;
+
+/// Segment layout version.
+static const uint32_t TransportVersion = 1;
+
+/// Record length marking the unused end of the ring, skipped by the reader.
+static const uint32_t TransportWrap = UINT32_MAX;
+
+/// Name, type or body length marking a nil type or body.
+static const uint16_t TransportNilType = UINT16_MAX;
+static const uint32_t TransportNilBody = UINT32_MAX;
+
+/// Read and write positions of one ring, on separate cache lines.
+typedef struct {
+    _Alignas(64) atomic_uint_least64_t head;
+    _Alignas(64) atomic_uint_least64_t tail;
+} TransportRing;
+
+/// Start of the segment; the ring data follows, one `capacity` sized ring per direction.
+typedef struct {
+    atomic_uint_least32_t magic;
+    uint32_t version;
+    uint64_t capacity;
+    TransportRing rings[2];
+} TransportSegment;
+
+/// Record payload formats: the inline encoding below, or a `NotificationCodec` encoding.
+typedef NS_ENUM(uint32_t, TransportFormat) {
+    TransportFormatInline = 0,
+    TransportFormatCodec = 1
+};
+
+/// Record header in the ring, followed by the payload padded to 8 bytes.
+typedef struct {
+    uint32_t length;
+    uint32_t format;
+} TransportRecord;
+
+/// Payload header: name length, type length, body length; followed by the name, type and body bytes.
+typedef struct {
+    uint16_t nameLength;
+    uint16_t typeLength;
+    uint32_t bodyLength;
+} TransportPayload;
+
+/// Round a length up to a multiple of 8.
+static inline uint64_t align8(uint64_t length) {
+    return (length + 7) & ~(uint64_t)7;
+}
+
+@interface SharedMemoryTransport()
+
+/// Serial queue the reader drains the inbound ring on.
+@property (nonatomic, strong) dispatch_queue_t readerQueue;
+
+/// Timer polling the inbound ring.
+@property (nonatomic, strong, nullable) dispatch_source_t reader;
+
+/// Interval the reader is currently scheduled at, between `pollInterval` and `maxPollInterval`. Reader queue only.
+@property (nonatomic) NSTimeInterval scheduledInterval;
+
+@end
+
+/**
+A notification transport over a POSIX shared-memory segment.
+
+Each direction is a single-producer, single-consumer byte ring.
+Records are written at the tail and published by a release store of
+the tail; the reader consumes them up to an acquired tail and frees
+the space by a release store of the head. A record that does not fit
+before the end of the ring is preceded by a wrap marker and written
+at the start. Lengths are in host byte order, both ends are on the
+same host.
+
+Writers in the local process are serialized by a mutex, which does
+not enter the kernel unless writers contend.
+
+The reader polls at `pollInterval` while records arrive. Every poll
+that finds the ring empty doubles the interval, up to
+`maxPollInterval`, so an idle transport wakes rarely; the first
+record read brings it back to `pollInterval`.
+
+The peer process is not trusted: a record or tail that does not fit
+in the ring closes the transport instead of being read.
+
+`@see View`
+*/
+@implementation SharedMemoryTransport {
+    /// The mapped segment.
+    TransportSegment *_segment;
+    
+    /// Size of the mapping in bytes.
+    size_t _size;
+    
+    /// Ring written by this side, and ring read by this side.
+    TransportRing *_outRing;
+    TransportRing *_inRing;
+    uint8_t *_outData;
+    uint8_t *_inData;
+    
+    /// Whether this side created the segment, and unlinks it on close.
+    BOOL _owner;
+    
+    /// Serializes local writers.
+    pthread_mutex_t _writeLock;
+    
+    /// Whether the transport has been closed.
+    atomic_bool _closed;
+}
+
+/**
+Create a shared-memory segment and connect the local Core to it.
+
+- parameter name: the segment name
+- parameter key: multitonKey of the local Core
+- parameter capacity: the size of each ring buffer in bytes
+- parameter error: on failure, the reason the segment could not be created
+- returns: a new transport, or nil on failure
+*/
++ (nullable instancetype)createWithName:(NSString *)name key:(NSString *)key capacity:(NSUInteger)capacity error:(NSError **)error {
+    uint64_t ringCapacity = 4096;
+    while (ringCapacity < capacity) ringCapacity <<= 1;
+    size_t size = sizeof(TransportSegment) + 2 * ringCapacity;
+    
+    int fd = shm_open(name.fileSystemRepresentation, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0) return [self posixError:error code:errno name:name];
+    if (ftruncate(fd, (off_t)size) != 0) {
+        int code = errno;
+        close(fd);
+        shm_unlink(name.fileSystemRepresentation);
+        return [self posixError:error code:code name:name];
+    }
+    
+    TransportSegment *segment = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int code = errno;
+    close(fd);
+    if (segment == MAP_FAILED) {
+        shm_unlink(name.fileSystemRepresentation);
+        return [self posixError:error code:code name:name];
+    }
+    
+    segment->version = TransportVersion;
+    segment->capacity = ringCapacity;
+    for (int i = 0; i < 2; i++) {
+        atomic_init(&segment->rings[i].head, 0);
+        atomic_init(&segment->rings[i].tail, 0);
+    }
+    // the magic is published last, the opening side checks it before anything else
+    atomic_store_explicit(&segment->magic, TransportMagic, memory_order_release);
+    
+    return [[SharedMemoryTransport alloc] initWithName:name key:key segment:segment size:size owner:YES];
+}
+
+/**
+Open a shared-memory segment and connect the local Core to it.
+
+- parameter name: the segment name
+- parameter key: multitonKey of the local Core
+- parameter error: on failure, the reason the segment could not be opened
+- returns: a new transport, or nil on failure
+*/
++ (nullable instancetype)openWithName:(NSString *)name key:(NSString *)key error:(NSError **)error {
+    int fd = shm_open(name.fileSystemRepresentation, O_RDWR, 0);
+    if (fd < 0) return [self posixError:error code:errno name:name];
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        int code = errno;
+        close(fd);
+        return [self posixError:error code:code name:name];
+    }
+    size_t size = (size_t)info.st_size;
+    if (size < sizeof(TransportSegment)) {
+        close(fd);
+        return [self formatError:error name:name];
+    }
+    
+    TransportSegment *segment = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int code = errno;
+    close(fd);
+    if (segment == MAP_FAILED) return [self posixError:error code:code name:name];
+    
+    uint64_t capacity = segment->capacity;
+    if (atomic_load_explicit(&segment->magic, memory_order_acquire) != TransportMagic ||
+        segment->version != TransportVersion ||
+        capacity < 4096 || (capacity & (capacity - 1)) != 0 ||
+        size < sizeof(TransportSegment) + 2 * capacity) {
+        munmap(segment, size);
+        return [self formatError:error name:name];
+    }
+    
+    return [[SharedMemoryTransport alloc] initWithName:name key:key segment:segment size:size owner:NO];
+}
+
+/**
+Report a failed system call.
+
+- parameter error: receives the error, if not NULL
+- parameter code: the errno of the failed call
+- parameter name: the segment name
+- returns: nil, for convenience
+*/
++ (nullable id)posixError:(NSError **)error code:(int)code name:(NSString *)name {
+    if (error != NULL) {
+        *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:code userInfo:@{
+            NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Shared memory segment '%@': %s.", name, strerror(code)]
+        }];
+    }
+    return nil;
+}
+
+/**
+Report a segment that is not in the expected format.
+
+- parameter error: receives the error, if not NULL
+- parameter name: the segment name
+- returns: nil, for convenience
+*/
++ (nullable id)formatError:(NSError **)error name:(NSString *)name {
+    if (error != NULL) {
+        *error = [NSError errorWithDomain:@"org.puremvc.transport" code:1 userInfo:@{
+            NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Invalid shared memory segment '%@'.", name]
+        }];
+    }
+    return nil;
+}
+
+/**
+Constructor.
+
+The creating side writes ring 0 and reads ring 1, the opening side
+the other way around.
+
+- parameter name: the segment name
+- parameter key: multitonKey of the local Core
+- parameter segment: the mapped segment
+- parameter size: the size of the mapping
+- parameter owner: whether this side created the segment
+*/
+- (instancetype)initWithName:(NSString *)name key:(NSString *)key segment:(TransportSegment *)segment size:(size_t)size owner:(BOOL)owner {
+    if (self = [super init]) {
+        _name = [name copy];
+        _multitonKey = [key copy];
+        _segment = segment;
+        _size = size;
+        _owner = owner;
+        _capacity = (NSUInteger)segment->capacity;
+        
+        uint8_t *data = (uint8_t *)segment + sizeof(TransportSegment);
+        int out = owner ? 0 : 1;
+        _outRing = &segment->rings[out];
+        _inRing = &segment->rings[1 - out];
+        _outData = data + out * segment->capacity;
+        _inData = data + (1 - out) * segment->capacity;
+        
+        pthread_mutex_init(&_writeLock, NULL);
+        atomic_init(&_closed, false);
+        
+        _readerQueue = dispatch_queue_create("org.puremvc.transport.reader", DISPATCH_QUEUE_SERIAL);
+        _reader = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _readerQueue);
+        __weak SharedMemoryTransport *weakSelf = self;
+        dispatch_source_set_event_handler(_reader, ^{
+            [weakSelf poll];
+        });
+        // the segment is unmapped once the reader can no longer touch it
+        size_t mappedSize = size;
+        dispatch_source_set_cancel_handler(_reader, ^{
+            munmap(segment, mappedSize);
+        });
+        _maxPollInterval = 0.064;
+        self.pollInterval = 0.001;
+        dispatch_resume(_reader);
+    }
+    return self;
+}
+
+/// Closes the transport.
+- (void)dealloc {
+    [self close];
+    pthread_mutex_destroy(&_writeLock);
+}
+
+/**
+Set the polling interval of the reader while records arrive.
+
+- parameter pollInterval: the interval in seconds
+*/
+- (void)setPollInterval:(NSTimeInterval)pollInterval {
+    _pollInterval = pollInterval;
+    [self scheduleReader:pollInterval];
+}
+
+/**
+Schedule the reader's timer.
+
+- parameter interval: the interval in seconds
+*/
+- (void)scheduleReader:(NSTimeInterval)interval {
+    uint64_t nanoseconds = (uint64_t)(interval * NSEC_PER_SEC);
+    dispatch_source_set_timer(self.reader, dispatch_time(DISPATCH_TIME_NOW, (int64_t)nanoseconds), nanoseconds, nanoseconds / 10);
+}
+
+/**
+Drain the inbound ring and adapt the polling interval.
+
+Runs on the reader queue: the interval goes back to `pollInterval`
+when records were read, and doubles up to `maxPollInterval` when
+the ring was empty.
+*/
+- (void)poll {
+    NSTimeInterval pollInterval = self.pollInterval;
+    NSTimeInterval interval = [self drain] ? pollInterval : MAX(MIN(self.scheduledInterval * 2, self.maxPollInterval), pollInterval);
+    if (interval == self.scheduledInterval) return;
+    self.scheduledInterval = interval;
+    [self scheduleReader:interval];
+}
+
+/**
+Write a notification to the Core on the other side.
+
+Without a `codec`, the payload is encoded straight into the ring
+and nothing is allocated on the way.
+
+- parameter notification: the notification, with a nil or `NSData` body unless a `codec` is set
+- returns: NO if the ring is full, the notification too large, or the transport closed
+*/
+- (BOOL)write:(id<INotification>)notification {
+    NotificationCodec *codec = self.codec;
+    id body = notification.body;
+    if (codec == nil && body != nil && ![body isKindOfClass:[NSData class]]) {
+        [NSException raise:@"SharedMemoryTransportException" format:@"Notification '%@' body must be nil or NSData.", notification.name];
+    }
+    if (atomic_load_explicit(&_closed, memory_order_relaxed)) return NO;
+    
+    NSData *encoded = codec != nil ? [codec encode:notification] : nil;
+    NSString *name = notification.name;
+    NSString *type = notification.type;
+    NSData *data = body;
+    NSUInteger nameLength = encoded == nil ? [name lengthOfBytesUsingEncoding:NSUTF8StringEncoding] : 0;
+    NSUInteger typeLength = encoded == nil && type != nil ? [type lengthOfBytesUsingEncoding:NSUTF8StringEncoding] : 0;
+    uint64_t payloadLength = encoded != nil ? encoded.length : sizeof(TransportPayload) + nameLength + typeLength + data.length;
+    uint64_t recordLength = sizeof(TransportRecord) + align8(payloadLength);
+    if (nameLength >= TransportNilType || typeLength >= TransportNilType || recordLength > _capacity / 2) return NO;
+    
+    pthread_mutex_lock(&_writeLock);
+    if (atomic_load_explicit(&_closed, memory_order_relaxed)) {
+        pthread_mutex_unlock(&_writeLock);
+        return NO;
+    }
+    uint64_t mask = _capacity - 1;
+    uint64_t tail = atomic_load_explicit(&_outRing->tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&_outRing->head, memory_order_acquire);
+    uint64_t offset = tail & mask;
+    uint64_t contiguous = _capacity - offset;
+    uint64_t needed = recordLength + (contiguous < recordLength ? contiguous : 0);
+    if (_capacity - (tail - head) < needed) {
+        pthread_mutex_unlock(&_writeLock);
+        return NO;
+    }
+    
+    if (contiguous < recordLength) {
+        ((TransportRecord *)(_outData + offset))->length = TransportWrap;
+        tail += contiguous;
+        offset = 0;
+    }
+    
+    uint8_t *record = _outData + offset;
+    ((TransportRecord *)record)->length = (uint32_t)payloadLength;
+    ((TransportRecord *)record)->format = encoded != nil ? TransportFormatCodec : TransportFormatInline;
+    if (encoded != nil) {
+        memcpy(record + sizeof(TransportRecord), encoded.bytes, encoded.length);
+        atomic_store_explicit(&_outRing->tail, tail + recordLength, memory_order_release);
+        pthread_mutex_unlock(&_writeLock);
+        return YES;
+    }
+    
+    TransportPayload *payload = (TransportPayload *)(record + sizeof(TransportRecord));
+    payload->nameLength = (uint16_t)nameLength;
+    payload->typeLength = type != nil ? (uint16_t)typeLength : TransportNilType;
+    payload->bodyLength = data != nil ? (uint32_t)data.length : TransportNilBody;
+    
+    uint8_t *bytes = (uint8_t *)(payload + 1);
+    [name getBytes:bytes maxLength:nameLength usedLength:NULL encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, name.length) remainingRange:NULL];
+    bytes += nameLength;
+    if (type != nil) {
+        [type getBytes:bytes maxLength:typeLength usedLength:NULL encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, type.length) remainingRange:NULL];
+        bytes += typeLength;
+    }
+    if (data.length > 0) memcpy(bytes, data.bytes, data.length);
+    
+    atomic_store_explicit(&_outRing->tail, tail + recordLength, memory_order_release);
+    pthread_mutex_unlock(&_writeLock);
+    return YES;
+}
+
+/**
+Decode every record in the inbound ring and deliver it to the `View` of the local Core.
+
+Runs on the reader queue. Each record's space is handed back to
+the writer as soon as it has been decoded. The `View` is looked up
+without creating one; records read while the local Core has no
+`View` are discarded.
+
+Every record is checked against the ring before it is read: a tail
+more than `capacity` ahead of the head, or a record running past the
+end of the ring or beyond the tail, closes the transport.
+
+- returns: whether the ring had anything to read
+*/
+- (BOOL)drain {
+    if (atomic_load_explicit(&_closed, memory_order_relaxed)) return NO;
+    
+    uint64_t mask = _capacity - 1;
+    uint64_t head = atomic_load_explicit(&_inRing->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&_inRing->tail, memory_order_acquire);
+    if (head == tail) return NO;
+    
+    id<IView> view = [View viewForKey:self.multitonKey];
+    while (head != tail) {
+        uint64_t offset = head & mask;
+        uint64_t available = tail - head;
+        if (available > _capacity || available < sizeof(TransportRecord)) {
+            [self close];
+            return YES;
+        }
+        
+        // read once, the peer may still write to the ring
+        uint32_t length = ((TransportRecord *)(_inData + offset))->length;
+        if (length == TransportWrap) {
+            if (_capacity - offset > available) {
+                [self close];
+                return YES;
+            }
+            head += _capacity - offset;
+            continue;
+        }
+        uint64_t recordLength = sizeof(TransportRecord) + align8(length);
+        if (recordLength > _capacity - offset || recordLength > available) {
+            [self close];
+            return YES;
+        }
+        
+        id<INotification> notification = nil;
+        if (((TransportRecord *)(_inData + offset))->format == TransportFormatCodec) {
+            // copied out of the ring, the body decoded by the codec is a slice of the copy
+            NSData *encoded = [NSData dataWithBytes:_inData + offset + sizeof(TransportRecord) length:length];
+            notification = [(self.codec ?: [NotificationCodec codec]) decode:encoded error:NULL];
+        } else {
+            notification = [self decode:_inData + offset + sizeof(TransportRecord) length:length];
+        }
+        head += recordLength;
+        atomic_store_explicit(&_inRing->head, head, memory_order_release);
+        
+        if (notification != nil) [view notifyObservers:notification];
+        if (head == tail) tail = atomic_load_explicit(&_inRing->tail, memory_order_acquire);
+    }
+    return YES;
+}
+
+/**
+Decode a notification payload.
+
+The body is copied out of the ring, whose space is reused by the writer.
+
+- parameter bytes: the payload
+- parameter length: the payload length
+- returns: the notification, or nil if the payload is malformed
+*/
+- (nullable id<INotification>)decode:(const uint8_t *)bytes length:(uint32_t)length {
+    if (length < sizeof(TransportPayload)) return nil;
+    TransportPayload payload;
+    memcpy(&payload, bytes, sizeof(payload));
+    
+    uint64_t typeLength = payload.typeLength != TransportNilType ? payload.typeLength : 0;
+    uint64_t bodyLength = payload.bodyLength != TransportNilBody ? payload.bodyLength : 0;
+    if (sizeof(payload) + payload.nameLength + typeLength + bodyLength > length) return nil;
+    
+    const uint8_t *cursor = bytes + sizeof(payload);
+    NSString *name = [[NSString alloc] initWithBytes:cursor length:payload.nameLength encoding:NSUTF8StringEncoding];
+    cursor += payload.nameLength;
+    NSString *type = nil;
+    if (payload.typeLength != TransportNilType) {
+        type = [[NSString alloc] initWithBytes:cursor length:typeLength encoding:NSUTF8StringEncoding];
+        cursor += typeLength;
+    }
+    NSData *body = payload.bodyLength != TransportNilBody ? [NSData dataWithBytes:cursor length:bodyLength] : nil;
+    
+    if (name == nil) return nil;
+    return [Notification withName:name body:body type:type];
+}
+
+/**
+Stop reading and unmap the segment. The creating side also unlinks its name.
+*/
+- (void)close {
+    if (atomic_exchange(&_closed, true)) return;
+    
+    // the cancel handler unmaps, after any drain in progress; writers are kept out by the lock
+    pthread_mutex_lock(&_writeLock);
+    dispatch_source_cancel(self.reader);
+    if (_owner) shm_unlink(self.name.fileSystemRepresentation);
+    pthread_mutex_unlock(&_writeLock);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
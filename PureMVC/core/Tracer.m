@@ -0,0 +1,391 @@
+//
+//  Tracer.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <objc/runtime.h>
+#import <pthread.h>
+#import <stdatomic.h>
+#import <stdlib.h>
+#import <string.h>
+#import <unistd.h>
+#import "Tracer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+enum {
+    /// The deepest nesting of open spans per thread; deeper spans are not begun.
+    StackDepth = 128,
+    /// Spans a buffer's storage first holds; it doubles up to `bufferCapacity`.
+    InitialSpans = 256
+};
+
+/// A span, open on a thread's stack or recorded in its buffer.
+typedef struct {
+    uint64_t span;
+    uint64_t parent;
+    uint64_t start;
+    uint64_t end;
+    /// The span's name, an `NSString` or a class.
+    __strong id name;
+    /// The multiton key of the span's Core, or nil.
+    __strong NSString *core;
+    TraceCategory category;
+    /// The number of the thread that recorded the span.
+    uint32_t tid;
+} TraceSpan;
+
+/**
+Release the references of spans.
+
+- parameter spans: the spans
+- parameter count: the number of spans
+*/
+static void clearSpans(TraceSpan *spans, size_t count) {
+    for (size_t i = 0; i < count; i++) spans[i] = (TraceSpan){ 0 };
+}
+
+/**
+A thread's open spans and recorded spans.
+
+A buffer belongs to one thread at a time. When its thread exits it
+goes on the free list for the next new thread, its recorded spans
+kept for export.
+*/
+@interface TraceBuffer : NSObject {
+@public
+    /// Spans begun and not yet ended, innermost last; owned by the thread.
+    TraceSpan *_stack;
+    size_t _depth;
+    /// Recorded spans, guarded by `_lock` against export and reset; grown on demand.
+    TraceSpan *_spans;
+    size_t _count;
+    size_t _allocated;
+    pthread_mutex_t _lock;
+    /// The number of the owning thread, and whether a thread owns the buffer, guarded by `buffersLock`.
+    uint32_t _tid;
+    BOOL _owned;
+}
+@end
+
+@implementation TraceBuffer
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _stack = calloc(StackDepth, sizeof(TraceSpan));
+        pthread_mutex_init(&_lock, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    clearSpans(_stack, _depth);
+    clearSpans(_spans, _count);
+    free(_stack);
+    free(_spans);
+    pthread_mutex_destroy(&_lock);
+}
+
+/**
+Record a span, growing the storage up to `bufferCapacity`. Call with `_lock` held.
+
+- parameter span: the span
+- parameter capacity: the most spans the buffer holds
+- returns: whether the span was recorded
+*/
+- (BOOL)record:(TraceSpan *)span capacity:(size_t)capacity {
+    if (_count >= capacity) return NO;
+    if (_count == _allocated) {
+        size_t allocated = MIN(MAX(_allocated * 2, (size_t)InitialSpans), capacity);
+        TraceSpan *spans = realloc(_spans, allocated * sizeof(TraceSpan));
+        if (spans == NULL) return NO;
+        // strong references move with the bytes; the new slots start out nil
+        memset(spans + _allocated, 0, (allocated - _allocated) * sizeof(TraceSpan));
+        _spans = spans;
+        _allocated = allocated;
+    }
+    _spans[_count++] = *span;
+    return YES;
+}
+
+/// Release the recorded spans and their storage. Call with `_lock` held.
+- (void)discard {
+    clearSpans(_spans, _count);
+    free(_spans);
+    _spans = NULL;
+    _count = 0;
+    _allocated = 0;
+}
+
+@end
+
+/// Span ids, 0 is never used.
+static atomic_uint_fast64_t nextSpan = 0;
+
+/// Spans not recorded because a buffer was full.
+static atomic_uint_fast64_t droppedSpans = 0;
+
+/// The most spans a buffer holds.
+static atomic_size_t bufferCapacity = 65536;
+
+/// Every buffer, those without a thread on the free list, guarded by `buffersLock`.
+static NSMutableArray<TraceBuffer *> *buffers = nil;
+static NSMutableArray<TraceBuffer *> *freeBuffers = nil;
+/// Names of named threads by number, and the last number given, guarded by `buffersLock`.
+static NSMutableDictionary<NSNumber *, NSString *> *threadNames = nil;
+static uint32_t lastTid = 0;
+static pthread_mutex_t buffersLock = PTHREAD_MUTEX_INITIALIZER;
+
+/// Hands a thread's buffer back when the thread exits.
+static pthread_key_t bufferKey;
+
+/// The calling thread's buffer, owned by `buffers`.
+static __thread __unsafe_unretained TraceBuffer *currentBuffer = nil;
+
+/**
+Put the buffer of an exiting thread on the free list, ending nothing
+it left open.
+
+- parameter value: the thread's buffer
+*/
+static void releaseBuffer(void *value) {
+    TraceBuffer *buffer = (__bridge TraceBuffer *)value;
+    clearSpans(buffer->_stack, buffer->_depth);
+    buffer->_depth = 0;
+    currentBuffer = nil;
+
+    pthread_mutex_lock(&buffersLock);
+    buffer->_owned = NO;
+    [freeBuffers addObject:buffer];
+    pthread_mutex_unlock(&buffersLock);
+}
+
+/// Initializes the buffer lists and the key that releases a thread's buffer.
+__attribute__((constructor()))
+static void initialize(void) {
+    buffers = [NSMutableArray array];
+    freeBuffers = [NSMutableArray array];
+    threadNames = [NSMutableDictionary dictionary];
+    pthread_key_create(&bufferKey, releaseBuffer);
+}
+
+/// The calling thread's buffer, taken from the free list or created on its first span.
+static TraceBuffer *threadBuffer(void) {
+    if (currentBuffer != nil) return currentBuffer;
+
+    char name[64] = "";
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+
+    pthread_mutex_lock(&buffersLock);
+    TraceBuffer *buffer = freeBuffers.lastObject;
+    if (buffer != nil) {
+        [freeBuffers removeLastObject];
+    } else {
+        buffer = [[TraceBuffer alloc] init];
+        [buffers addObject:buffer];
+    }
+    buffer->_tid = ++lastTid;
+    buffer->_owned = YES;
+    if (name[0] != '\0') threadNames[@(buffer->_tid)] = @(name);
+    pthread_mutex_unlock(&buffersLock);
+
+    currentBuffer = buffer;
+    pthread_setspecific(bufferKey, (__bridge void *)buffer);
+    return buffer;
+}
+
+/**
+A process-wide span recorder writing Chrome trace-event JSON.
+
+Each thread owns a `TraceBuffer`. Its stack of open spans is touched
+only by the thread; ending a span moves it into the recorded spans
+under the buffer's own mutex, which only export and reset contend for.
+Span ids come from one atomic counter. A buffer's storage grows with
+the spans it records and is freed by reset. When a thread exits its
+buffer is reused by the next new thread, so threads that come and go
+do not each leave a buffer behind; each span carries its thread's
+number, so export still sees the spans of threads that have exited.
+*/
+@implementation Tracer
+
++ (BOOL)isEnabled {
+#if PUREMVC_INSTRUMENTATION
+    return (InstrumentationActiveFlags() & InstrumentationFlagTrace) != 0;
+#else
+    return NO;
+#endif
+}
+
++ (void)setEnabled:(BOOL)enabled {
+#if PUREMVC_INSTRUMENTATION
+    InstrumentationSetFlag(InstrumentationFlagTrace, enabled);
+#endif
+}
+
++ (NSUInteger)bufferCapacity {
+    return atomic_load(&bufferCapacity);
+}
+
++ (void)setBufferCapacity:(NSUInteger)capacity {
+    atomic_store(&bufferCapacity, MAX(capacity, (NSUInteger)1));
+}
+
++ (uint64_t)droppedSpans {
+    return atomic_load_explicit(&droppedSpans, memory_order_relaxed);
+}
+
+/**
+Begin a span on the current thread.
+
+- parameter category: what the span covers
+- parameter name: the span's name, a string or a class
+- parameter key: the multiton key of the span's Core, or nil to use its parent's
+- returns: the id of the span, or 0 if the thread's spans are nested too deeply
+*/
++ (uint64_t)beginSpan:(TraceCategory)category name:(id)name core:(nullable NSString *)key {
+    TraceBuffer *buffer = threadBuffer();
+    if (buffer->_depth == StackDepth) return 0;
+
+    TraceSpan *parent = buffer->_depth > 0 ? &buffer->_stack[buffer->_depth - 1] : NULL;
+    TraceSpan *span = &buffer->_stack[buffer->_depth++];
+    span->span = atomic_fetch_add_explicit(&nextSpan, 1, memory_order_relaxed) + 1;
+    span->parent = parent != NULL ? parent->span : 0;
+    span->name = name;
+    span->core = key ?: (parent != NULL ? parent->core : nil);
+    span->category = category;
+    span->tid = buffer->_tid;
+    span->end = 0;
+    span->start = InstrumentationNow();
+    return span->span;
+}
+
+/**
+End a span begun on the current thread, and any spans still open inside it.
+
+- parameter span: the id of the span; 0 or an id not open on this thread is ignored
+*/
++ (void)endSpan:(uint64_t)span {
+    if (span == 0) return;
+    uint64_t end = InstrumentationNow();
+    TraceBuffer *buffer = threadBuffer();
+
+    size_t index = buffer->_depth;
+    while (index > 0 && buffer->_stack[index - 1].span != span) index--;
+    if (index == 0) return;
+    index--;
+
+    size_t capacity = atomic_load_explicit(&bufferCapacity, memory_order_relaxed);
+    pthread_mutex_lock(&buffer->_lock);
+    for (size_t i = buffer->_depth; i > index; i--) {
+        TraceSpan *closed = &buffer->_stack[i - 1];
+        closed->end = end;
+        if (![buffer record:closed capacity:capacity]) {
+            atomic_fetch_add_explicit(&droppedSpans, 1, memory_order_relaxed);
+        }
+    }
+    pthread_mutex_unlock(&buffer->_lock);
+    clearSpans(&buffer->_stack[index], buffer->_depth - index);
+    buffer->_depth = index;
+}
+
+/**
+The name of a trace category.
+
+- parameter category: the category
+- returns: its name in the trace
+*/
++ (NSString *)nameOfCategory:(TraceCategory)category {
+    switch (category) {
+        case TraceCategoryNotify: return @"notify";
+        case TraceCategoryObserver: return @"observer";
+        case TraceCategoryCommand: return @"command";
+        case TraceCategorySubCommand: return @"subcommand";
+    }
+    return @"unknown";
+}
+
+/**
+Render every recorded span as Chrome trace-event JSON.
+
+Spans are complete (`"X"`) events with microsecond timestamps, and
+each thread gets a `thread_name` metadata event.
+
+- returns: the trace as JSON
+*/
++ (NSData *)traceEventJSON {
+    NSNumber *pid = @(getpid());
+    NSMutableArray<NSDictionary *> *events = [NSMutableArray array];
+    NSMutableSet<NSNumber *> *tids = [NSMutableSet set];
+
+    pthread_mutex_lock(&buffersLock);
+    for (TraceBuffer *buffer in buffers) {
+        if (buffer->_owned) [tids addObject:@(buffer->_tid)];
+        pthread_mutex_lock(&buffer->_lock);
+        for (size_t i = 0; i < buffer->_count; i++) {
+            TraceSpan *span = &buffer->_spans[i];
+            id name = span->name;
+            NSMutableDictionary *args = [NSMutableDictionary dictionaryWithObject:@(span->span) forKey:@"span"];
+            if (span->parent != 0) args[@"parent"] = @(span->parent);
+            if (span->core != nil) args[@"core"] = span->core;
+            [tids addObject:@(span->tid)];
+            [events addObject:@{
+                @"name": object_isClass(name) ? NSStringFromClass(name) : [name description],
+                @"cat": [self nameOfCategory:span->category],
+                @"ph": @"X",
+                @"ts": @((double)span->start / 1000.0),
+                @"dur": @((double)(span->end - span->start) / 1000.0),
+                @"pid": pid,
+                @"tid": @(span->tid),
+                @"args": args
+            }];
+        }
+        pthread_mutex_unlock(&buffer->_lock);
+    }
+    for (NSNumber *tid in tids) {
+        NSString *threadName = threadNames[tid] ?: [NSString stringWithFormat:@"Thread %@", tid];
+        [events addObject:@{ @"name": @"thread_name", @"ph": @"M", @"pid": pid, @"tid": tid, @"args": @{ @"name": threadName } }];
+    }
+    pthread_mutex_unlock(&buffersLock);
+
+    return [NSJSONSerialization dataWithJSONObject:@{ @"traceEvents": events, @"displayTimeUnit": @"ns" } options:0 error:nil];
+}
+
+/**
+Write `traceEventJSON` to a file.
+
+- parameter url: the file URL to write to
+- parameter error: receives the error if writing fails
+- returns: whether the trace was written
+*/
++ (BOOL)writeToURL:(NSURL *)url error:(NSError **)error {
+    return [[self traceEventJSON] writeToURL:url options:NSDataWritingAtomic error:error];
+}
+
+/**
+Discard every recorded span, freeing the buffers' storage, and reset `droppedSpans`.
+
+Spans still open are kept and recorded when they end.
+*/
++ (void)reset {
+    pthread_mutex_lock(&buffersLock);
+    NSMutableDictionary<NSNumber *, NSString *> *names = [NSMutableDictionary dictionary];
+    for (TraceBuffer *buffer in buffers) {
+        pthread_mutex_lock(&buffer->_lock);
+        [buffer discard];
+        pthread_mutex_unlock(&buffer->_lock);
+        // keep the names of threads still running
+        NSString *name = buffer->_owned ? threadNames[@(buffer->_tid)] : nil;
+        if (name != nil) names[@(buffer->_tid)] = name;
+    }
+    [threadNames setDictionary:names];
+    pthread_mutex_unlock(&buffersLock);
+    atomic_store_explicit(&droppedSpans, 0, memory_order_relaxed);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,166 @@
+//
+//  VersionedReference.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <pthread.h>
+#import <sched.h>
+#import <stdatomic.h>
+#import "VersionedReference.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Number of versions kept alive; a slot is reused every `SlotCount` stores.
+#define SlotCount 4
+
+/**
+A reference to an immutable value that readers load without locking.
+
+Versions are stored round-robin in `SlotCount` slots. A reader loads
+the version, pins that version's slot, and then checks the version
+again: as long as the writer has not advanced far enough to be about
+to reuse the slot, the pin is in place before the writer looks at it,
+and the value stays retained by the slot until the reader has retained
+it in turn. Otherwise the reader unpins and retries.
+
+The writer waits for the pin count of the slot it is about to reuse
+to drop to zero before releasing the old value, which is what makes
+reclamation safe. Pins are held only for the few instructions it takes
+to retain the value, so the writer never waits for long.
+*/
+@implementation VersionedReference {
+    /// Values for the last `SlotCount` versions, indexed by version modulo `SlotCount`.
+    id _slots[SlotCount];
+    
+    /// Number of readers currently retaining the value in each slot.
+    atomic_uint_fast32_t _pins[SlotCount];
+    
+    /// The version of the most recently published value.
+    atomic_uint_fast64_t _version;
+    
+    /// Serializes writers.
+    pthread_mutex_t _writeLock;
+}
+
+/**
+ * Creates and returns a new `VersionedReference` holding the given value.
+ *
+ * @param value The initial value, published as version 0.
+ * @return A new `VersionedReference` instance.
+ */
++ (instancetype)withValue:(nullable id)value {
+    return [[self alloc] initWithValue:value];
+}
+
+/**
+Constructor.
+
+- parameter value: the initial value, published as version 0
+*/
+- (instancetype)initWithValue:(nullable id)value {
+    if (self = [super init]) {
+        for (int i = 0; i < SlotCount; i++) atomic_init(&_pins[i], 0);
+        atomic_init(&_version, 0);
+        pthread_mutex_init(&_writeLock, NULL);
+        _slots[0] = value;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    pthread_mutex_destroy(&_writeLock);
+}
+
+/// The version of the current value.
+- (uint64_t)version {
+    return atomic_load(&_version);
+}
+
+/**
+Load the current value without taking a lock.
+
+- returns: the current value
+*/
+- (nullable id)load {
+    return [self loadWithVersion:NULL];
+}
+
+/**
+Load the current value together with its version.
+
+- parameter version: receives the version of the returned value, if not NULL
+- returns: the current value
+*/
+- (nullable id)loadWithVersion:(nullable uint64_t *)version {
+    for (;;) {
+        uint64_t current = atomic_load(&_version);
+        int slot = (int)(current % SlotCount);
+        atomic_fetch_add(&_pins[slot], 1);
+        
+        // the writer reuses this slot when publishing current + SlotCount,
+        // and checks the pin only once it has published current + SlotCount - 1
+        if (atomic_load(&_version) - current < SlotCount - 1) {
+            id value = _slots[slot];
+            atomic_fetch_sub(&_pins[slot], 1);
+            if (version != NULL) *version = current;
+            return value;
+        }
+        atomic_fetch_sub(&_pins[slot], 1);
+    }
+}
+
+/**
+Publish a new value.
+
+- parameter value: the new value
+- returns: the version of the published value
+*/
+- (uint64_t)store:(nullable id)value {
+    pthread_mutex_lock(&_writeLock);
+    uint64_t version = [self publish:value];
+    pthread_mutex_unlock(&_writeLock);
+    return version;
+}
+
+/**
+Publish a value derived from the current one.
+
+- parameter block: returns the new value given the current one
+- returns: the version of the published value
+*/
+- (uint64_t)update:(id _Nullable (^)(id _Nullable current))block {
+    pthread_mutex_lock(&_writeLock);
+    id value = block(_slots[atomic_load(&_version) % SlotCount]);
+    uint64_t version = [self publish:value];
+    pthread_mutex_unlock(&_writeLock);
+    return version;
+}
+
+/**
+Write a value into the next slot and publish its version.
+
+Must be called with `_writeLock` held.
+
+- parameter value: the new value
+- returns: the version of the published value
+*/
+- (uint64_t)publish:(nullable id)value {
+    uint64_t version = atomic_load(&_version) + 1;
+    int slot = (int)(version % SlotCount);
+    
+    // wait for readers still retaining the value being replaced
+    while (atomic_load(&_pins[slot]) != 0) {
+        sched_yield();
+    }
+    _slots[slot] = value;
+    atomic_store(&_version, version);
+    return version;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -6,10 +6,21 @@
 //  Your reuse is governed by the BSD 3-Clause License
 //
 
+#import <objc/runtime.h>
 #import "IView.h"
 #import "View.h"
+#import "Controller.h"
 #import "Observer.h"
 #import "IMediator.h"
+#import "Handle.h"
+#import "MultitonRegistry.h"
+#import "Instrumentation.h"
+#import "Tracer.h"
+#import "FlightRecorder.h"
+#import "MemoryAccount.h"
+#import "Watchdog.h"
+#import "MapLock.h"
+#import "Probes.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -21,24 +32,30 @@ NS_ASSUME_NONNULL_BEGIN
 /// Mapping of notification names to their list of observers.
 @property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableArray<id<IObserver>> *> *observerMap;
 
-/// Queue used to synchronize access to `observerMap`.
-@property (nonatomic, strong) dispatch_queue_t observerMapQueue;
+/// Lock synchronizing access to `observerMap`.
+@property (nonatomic, strong) id<IMapLock> observerMapLock;
 
 /// Mapping of mediator names to their registered `IMediator` instances.
 @property (nonatomic, strong) NSMutableDictionary<NSString *, id<IMediator>> *mediatorMap;
 
-/// Queue used to synchronize access to `mediatorMap`.
-@property (nonatomic, strong) dispatch_queue_t mediatorMapQueue;
+/// Mapping of mediator names to the handles tracking them.
+@property (nonatomic, strong) NSMutableDictionary<NSString *, Handle *> *handleMap;
+
+/// Lock synchronizing access to `mediatorMap` and `handleMap`.
+@property (nonatomic, strong) id<IMapLock> mediatorMapLock;
+
+/// Storage of `memoryAccount`, nil until first use.
+@property (atomic, strong, nullable) MemoryAccount *account;
 
 @end
 
 /// Multiton registry for storing `View` instances by key.
-static NSMutableDictionary<NSString *, id<IView>> *instanceMap = nil;
+static MultitonRegistry<id<IView>> *instanceMap = nil;
 
 /// Initializes the global `View` instance map.
 __attribute__((constructor()))
 static void initialize(void) {
-    instanceMap = [NSMutableDictionary dictionary];
+    instanceMap = [MultitonRegistry registry];
 }
 
 /**
@@ -70,23 +87,29 @@ View Multiton Factory method.
 - returns: the Multiton instance returned by executing the passed closure
 */
 + (id<IView>)getInstance:(NSString *)key factory:(id<IView> (^)(NSString *key))factory {
-    @synchronized (instanceMap) {
-        if (instanceMap[key] == nil) {
-            instanceMap[key] = factory(key);
-        }
-        return instanceMap[key];
-    }
+    return [instanceMap objectForKey:key factory:factory];
+}
+
+/**
+The View of a Core, if it has one.
+
+- parameter key: multitonKey
+- returns: the Multiton instance, or nil
+*/
++ (nullable id<IView>)viewForKey:(NSString *)key {
+    return [instanceMap objectForKey:key];
 }
 
 /**
 Remove an IView instance
 
+Every `IMediator` and `IObserver` registered with a `View` is removed with it.
+
 - parameter key: of IView instance to remove
 */
 + (void)removeView:(NSString *)key {
-    @synchronized (instanceMap) {
-        [instanceMap removeObjectForKey:key];
-    }
+    id<IView> view = [instanceMap removeObjectForKey:key];
+    if ([(id)view isKindOfClass:[View class]]) [(View *)view removeAllMediators];
 }
 
 /**
@@ -114,7 +137,7 @@ Factory method `View.getInstance( multitonKey )`
 @throws Error if instance for this Multiton key has already been constructed
 */
 - (instancetype)initWithKey:(NSString *)key {
-    if (instanceMap[key] != nil) {
+    if ([instanceMap objectForKey:key] != nil) {
         [NSException raise:@"ViewAlreadyExistsException" format:@"A View instance already exists for key '%@'.", key];
     }
     if (self = [super init]) {
@@ -124,14 +147,24 @@ Factory method `View.getInstance( multitonKey )`
         [instanceMap setObject:self forKey:key];
         // Mapping of Mediator names to Mediator instances
         _mediatorMap = [NSMutableDictionary dictionary];
-        // Concurrent queue for mediatorMap
+        // Mapping of Mediator names to handles
+        _handleMap = [NSMutableDictionary dictionary];
+        // Lock for mediatorMap, with the Core's MapLockStrategy
         // for speed and convenience of running concurrently while reading, and thread safety of blocking while mutating
-        _mediatorMapQueue = dispatch_queue_create("org.puremvc.view.mediatorMapQueue", DISPATCH_QUEUE_CONCURRENT);
+        _mediatorMapLock = [MapLock lockForCore:key label:@"org.puremvc.view.mediatorMapQueue"];
         // Mapping of Notification names to Observer lists
         _observerMap = [NSMutableDictionary dictionary];
-        // Concurrent queue for observerMap
+        // Lock for observerMap, with the Core's MapLockStrategy
         // for speed and convenience of running concurrently while reading, and thread safety of blocking while mutating
-        _observerMapQueue = dispatch_queue_create("org.puremvc.view.observerMapQueue", DISPATCH_QUEUE_CONCURRENT);
+        _observerMapLock = [MapLock lockForCore:key label:@"org.puremvc.view.observerMapQueue"];
+        // Dispatch histograms, recorded while Instrumentation is enabled
+        _instrumentation = [Instrumentation instrumentation];
+        // Ring of the most recent notifications, recorded while FlightRecorder is enabled
+        _flightRecorder = [FlightRecorder withKey:key capacity:FlightRecorder.defaultCapacity];
+        // Memory attributed to this Core, created now only while MemoryAccount is enabled
+        if (MemoryAccountingActive()) [self memoryAccount];
+        // Latency budgets, checked while Watchdog is enabled
+        _watchdog = [Watchdog withKey:key];
     }
     return self;
 }
@@ -144,13 +177,68 @@ of `INotifications` with a given name.
 - parameter observer: the `IObserver` to register
 */
 - (void)registerObserver:(NSString *)notificationName observer:(id<IObserver>)observer {
-    dispatch_barrier_sync(self.observerMapQueue, ^{
-        if (self.observerMap[notificationName] != nil) {
-            [self.observerMap[notificationName] addObject:observer];
-        } else {
-            self.observerMap[notificationName] = [NSMutableArray arrayWithObject:observer];
+    [self.observerMapLock write:^{
+        [self appendObserver:observer notificationName:notificationName];
+    }];
+}
+
+/**
+Register an `IObserver` for several notifications in a single barrier.
+
+- parameter observer: the `IObserver` to register
+- parameter notificationNames: the names of the `INotifications` to notify this `IObserver` of
+*/
+- (void)registerObserver:(id<IObserver>)observer notificationNames:(NSArray<NSString *> *)notificationNames {
+    [self.observerMapLock write:^{
+        for (NSString *notificationName in notificationNames) {
+            [self appendObserver:observer notificationName:notificationName];
         }
-    });
+    }];
+}
+
+/**
+Append an `IObserver` to the observer list of a notification,
+creating the list on first use.
+
+Must be called inside a write on `observerMapLock`.
+
+- parameter observer: the `IObserver` to append
+- parameter notificationName: the name of the notification
+*/
+- (void)appendObserver:(id<IObserver>)observer notificationName:(NSString *)notificationName {
+    NSMutableArray<id<IObserver>> *observers = self.observerMap[notificationName];
+    BOOL created = observers == nil;
+    if (created) {
+        observers = [NSMutableArray arrayWithObject:observer];
+        self.observerMap[notificationName] = observers;
+    } else {
+        [observers addObject:observer];
+    }
+    if (MemoryAccountingActive()) {
+        size_t list = created ? MemoryAccountSize(observers) + MemoryAccountEntrySize : 0;
+        [self.memoryAccount recordAllocation:MemoryCategoryObserverList bytes:list + sizeof(id)];
+    }
+}
+
+/**
+The `MemoryAccount` of this Core, created on first use so that Cores
+never accounted for do not register one. The mediators are added as
+its payload.
+
+- returns: the account shared with the Core's other actors
+*/
+- (MemoryAccount *)memoryAccount {
+    MemoryAccount *account = self.account;
+    if (account != nil) return account;
+    @synchronized (self) {
+        if (self.account == nil) {
+            account = [MemoryAccount getInstance:self.multitonKey];
+            __weak View *weakSelf = self;
+            [account addPayloadSource:^NSArray * _Nullable { return weakSelf.mediators; }];
+            self.account = account;
+        }
+    }
+    return self.account;
 }
 
 /**
@@ -163,18 +251,83 @@ the order in which they were registered.
 - parameter notification: the `INotification` to notify `IObservers` of.
 */
 - (void)notifyObservers:(id<INotification>)notification {
+    PUREMVC_PROBE2(notify_start, self.multitonKey.UTF8String, notification.name.UTF8String);
+#if PUREMVC_INSTRUMENTATION
+    unsigned flags = InstrumentationActiveFlags();
+    if ((flags & ~(unsigned)InstrumentationFlagFlightRecorder) != 0) {
+        [self instrumentedNotifyObservers:notification flags:flags];
+        PUREMVC_PROBE2(notify_end, self.multitonKey.UTF8String, notification.name.UTF8String);
+        return;
+    }
+    // the flight recorder alone, on by default, only times the send
+    uint64_t start = flags != 0 ? InstrumentationNow() : 0;
+#endif
     __block NSArray<id<IObserver>> *observers = nil;
-    dispatch_sync(self.observerMapQueue, ^{
+    [self.observerMapLock read:^{
         // Iteration Safe, the original array may change during the notification loop but irrespective of that all observers will be notified
         observers = [self.observerMap[notification.name] copy];
-    });
+    }];
     
     // Notify Observers
     for (id<IObserver> observer in observers) {
+        PUREMVC_PROBE3(observer_invoke, self.multitonKey.UTF8String, notification.name.UTF8String, object_getClassName(observer.context));
         [observer notifyObserver:notification];
     }
+#if PUREMVC_INSTRUMENTATION
+    if (flags != 0) [self.flightRecorder recordNotification:notification start:start duration:InstrumentationNow() - start fanout:observers.count];
+#endif
+    PUREMVC_PROBE2(notify_end, self.multitonKey.UTF8String, notification.name.UTF8String);
 }
 
+#if PUREMVC_INSTRUMENTATION
+/**
+`notifyObservers:` while a hook other than the flight recorder is on,
+timing the send, and each observer when histograms, tracing or the
+watchdog are on, recorded as `flags` ask into
+`instrumentation`, `Tracer` and `flightRecorder`, and checked against
+the `watchdog`'s budgets.
+
+- parameter notification: the `INotification` to notify `IObservers` of.
+- parameter flags: the `InstrumentationFlag`s turned on
+*/
+- (void)instrumentedNotifyObservers:(id<INotification>)notification flags:(unsigned)flags {
+    BOOL histograms = (flags & InstrumentationFlagHistograms) != 0;
+    BOOL tracing = (flags & InstrumentationFlagTrace) != 0;
+    BOOL watching = (flags & InstrumentationFlagWatchdog) != 0;
+    uint64_t start = InstrumentationNow();
+    uint64_t span = tracing ? [Tracer beginSpan:TraceCategoryNotify name:notification.name core:self.multitonKey] : 0;
+    __block NSArray<id<IObserver>> *observers = nil;
+    [self.observerMapLock read:^{
+        observers = [self.observerMap[notification.name] copy];
+    }];
+    if ((flags & InstrumentationFlagMemory) != 0 && observers != nil) {
+        [self.memoryAccount recordTransient:MemoryCategoryObserverList bytes:MemoryAccountSize(observers) + observers.count * sizeof(id)];
+    }
+    
+    for (id<IObserver> observer in observers) {
+        PUREMVC_PROBE3(observer_invoke, self.multitonKey.UTF8String, notification.name.UTF8String, object_getClassName(observer.context));
+        if (!histograms && !tracing && !watching) {
+            [observer notifyObserver:notification];
+            continue;
+        }
+        Class contextClass = [observer.context class];
+        uint64_t child = tracing && contextClass != Nil ? [Tracer beginSpan:TraceCategoryObserver name:contextClass core:self.multitonKey] : 0;
+        uint64_t begin = InstrumentationNow();
+        [observer notifyObserver:notification];
+        uint64_t latency = InstrumentationNow() - begin;
+        if (histograms && contextClass != Nil) [self.instrumentation recordObserver:contextClass latency:latency];
+        // commands are checked by the Controller, which names the command class
+        if (watching && contextClass != Nil && ![contextClass isSubclassOfClass:[Controller class]]) [self.watchdog checkNotification:notification.name contextClass:contextClass latency:latency];
+        [Tracer endSpan:child];
+    }
+    
+    if (span != 0) [Tracer endSpan:span];
+    uint64_t duration = InstrumentationNow() - start;
+    if (histograms) [self.instrumentation recordNotification:notification.name latency:duration fanout:observers.count];
+    if ((flags & InstrumentationFlagFlightRecorder) != 0) [self.flightRecorder recordNotification:notification start:start duration:duration fanout:observers.count];
+}
+#endif
+
 /**
 Remove the observer for a given notifyContext from an observer list for a given Notification name.
 
@@ -182,26 +335,55 @@ Remove the observer for a given notifyContext from an observer list for a given
 - parameter notifyContext: remove the observer with this object as its notifyContext
 */
 - (void)removeObserver:(NSString *)notificationName context:(id)context {
-    dispatch_barrier_sync(self.observerMapQueue, ^{
-        // the observer list for the notification under inspection
-        NSMutableArray<id<IObserver>> *observers = self.observerMap[notificationName];
-        
-        // find the observer for the notifyContext
-        for (id<IObserver> observer in observers) {
-            if ([observer compareNotifyContext:context]) {
-                // there can only be one Observer for a given notifyContext
-                // in any given Observer list, so remove it and break
-                [observers removeObject:observer];
-                break;
-            }
+    [self.observerMapLock write:^{
+        [self dropObserver:notificationName context:context];
+    }];
+}
+
+/**
+Remove the `IObserver` of a context from several notifications in a single barrier.
+
+- parameter notificationNames: which observer lists to remove from
+- parameter context: remove the observer with this object as its notifyContext
+*/
+- (void)removeObservers:(NSArray<NSString *> *)notificationNames context:(id)context {
+    [self.observerMapLock write:^{
+        for (NSString *notificationName in notificationNames) {
+            [self dropObserver:notificationName context:context];
         }
-        
-        // Also, when a Notification's Observer list length falls to
-        // zero, delete the notification key from the observer map
-        if ([observers count] == 0) {
-            [self.observerMap removeObjectForKey:notificationName];
+    }];
+}
+
+/**
+Remove the `IObserver` of a context from the observer list of a
+notification, deleting the list when it becomes empty.
+
+Must be called inside a write on `observerMapLock`.
+
+- parameter notificationName: which observer list to remove from
+- parameter context: remove the observer with this object as its notifyContext
+*/
+- (void)dropObserver:(NSString *)notificationName context:(id)context {
+    // the observer list for the notification under inspection
+    NSMutableArray<id<IObserver>> *observers = self.observerMap[notificationName];
+    
+    // find the observer for the notifyContext
+    for (id<IObserver> observer in observers) {
+        if ([observer compareNotifyContext:context]) {
+            // there can only be one Observer for a given notifyContext
+            // in any given Observer list, so remove it and break
+            [observers removeObject:observer];
+            if (MemoryAccountingActive()) [self.memoryAccount recordRelease:MemoryCategoryObserverList bytes:sizeof(id)];
+            break;
         }
-    });
+    }
+    
+    // Also, when a Notification's Observer list length falls to
+    // zero, delete the notification key from the observer map
+    if (observers != nil && [observers count] == 0) {
+        [self.observerMap removeObjectForKey:notificationName];
+        if (MemoryAccountingActive()) [self.memoryAccount recordRelease:MemoryCategoryObserverList bytes:MemoryAccountSize(observers) + MemoryAccountEntrySize];
+    }
 }
 
 /**
@@ -221,17 +403,19 @@ and registering it as an `Observer` for all `INotifications` the
 */
 - (void)registerMediator:(id<IMediator>)mediator {
     __block BOOL exists = NO;
-    dispatch_barrier_sync(self.mediatorMapQueue, ^{
+    [self.mediatorMapLock write:^{
         // do not allow re-registration (you must to removeMediator fist)
         exists = self.mediatorMap[mediator.name] != nil;
-        if (!exists)
+        if (!exists) {
             // Register the Mediator for retrieval by name
             self.mediatorMap[mediator.name] = mediator;
-    });
+            [self.handleMap[mediator.name] updateTarget:mediator];
+        }
+    }];
     
     if (exists) return;
     
-    // [mediator initializeNotifier:multitonKey];
+    [mediator initializeNotifier:self.multitonKey];
     
     // Create Observer referencing this mediator's handleNotification method
     id<IObserver> observer = [Observer withNotify:@selector(handleNotification:) context:mediator];
@@ -242,10 +426,79 @@ and registering it as an `Observer` for all `INotifications` the
         [self registerObserver:notificationName observer:observer];
     }
     
+    if (MemoryAccountingActive()) {
+        [self.memoryAccount recordAllocation:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+        if (interests.count > 0) [self.memoryAccount recordAllocation:MemoryCategoryObserver bytes:MemoryAccountObserverSize()];
+    }
+    
     // alert the mediator that it has been registered
+    PUREMVC_PROBE2(mediator_register, self.multitonKey.UTF8String, mediator.name.UTF8String);
     [mediator onRegister];
 }
 
+/**
+Register several `IMediator` instances with the `View`.
+
+The mediator map and the observer map are each updated in a single
+barrier. Mediators already registered by name are skipped, the rest
+are sent `onRegister` in order once both maps are updated.
+
+- parameter mediators: the `IMediator` instances to register
+*/
+- (void)registerMediators:(NSArray<id<IMediator>> *)mediators {
+    NSMutableArray<id<IMediator>> *registered = [NSMutableArray arrayWithCapacity:mediators.count];
+    [self.mediatorMapLock write:^{
+        for (id<IMediator> mediator in mediators) {
+            if (self.mediatorMap[mediator.name] != nil) continue;
+            self.mediatorMap[mediator.name] = mediator;
+            [self.handleMap[mediator.name] updateTarget:mediator];
+            [registered addObject:mediator];
+        }
+    }];
+    
+    // interests are collected outside the queues, mediators may call back into the View
+    NSMutableArray<id<IObserver>> *observers = [NSMutableArray arrayWithCapacity:registered.count];
+    NSMutableArray<NSArray *> *interests = [NSMutableArray arrayWithCapacity:registered.count];
+    for (id<IMediator> mediator in registered) {
+        [mediator initializeNotifier:self.multitonKey];
+        [observers addObject:[Observer withNotify:@selector(handleNotification:) context:mediator]];
+        [interests addObject:[mediator listNotificationInterests]];
+    }
+    
+    [self.observerMapLock write:^{
+        for (NSUInteger i = 0; i < observers.count; i++) {
+            for (NSString *notificationName in interests[i]) {
+                [self appendObserver:observers[i] notificationName:notificationName];
+            }
+        }
+    }];
+    
+    if (MemoryAccountingActive()) {
+        for (NSUInteger i = 0; i < registered.count; i++) {
+            [self.memoryAccount recordAllocation:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+            if (interests[i].count > 0) [self.memoryAccount recordAllocation:MemoryCategoryObserver bytes:MemoryAccountObserverSize()];
+        }
+    }
+    
+    for (id<IMediator> mediator in registered) {
+        PUREMVC_PROBE2(mediator_register, self.multitonKey.UTF8String, mediator.name.UTF8String);
+        [mediator onRegister];
+    }
+}
+
+/**
+A snapshot of the registered `IMediator` instances.
+
+- returns: the registered mediators
+*/
+- (NSArray<id<IMediator>> *)mediators {
+    __block NSArray<id<IMediator>> *mediators = nil;
+    [self.mediatorMapLock read:^{
+        mediators = [self.mediatorMap allValues];
+    }];
+    return mediators;
+}
+
 /**
 Retrieve an `IMediator` from the `View`.
 
@@ -254,12 +507,34 @@ Retrieve an `IMediator` from the `View`.
 */
 - (nullable id<IMediator>)retrieveMediator:(NSString *)mediatorName {
     __block id<IMediator> mediator = nil;
-    dispatch_sync(self.mediatorMapQueue, ^{
+    [self.mediatorMapLock read:^{
         mediator = self.mediatorMap[mediatorName];
-    });
+    }];
     return mediator;
 }
 
+/**
+Retrieve a handle that tracks the `IMediator` registered under a name.
+
+The handle is created on first request and kept current by
+`registerMediator:` and `removeMediator:`.
+
+- parameter mediatorName: the name of the `IMediator` to track
+- returns: the handle for `mediatorName`
+*/
+- (id<IHandle>)retrieveMediatorHandle:(NSString *)mediatorName {
+    __block Handle *handle = nil;
+    [self.mediatorMapLock write:^{
+        handle = self.handleMap[mediatorName];
+        if (handle == nil) {
+            handle = [Handle withName:mediatorName resolver:nil];
+            [handle updateTarget:self.mediatorMap[mediatorName]];
+            self.handleMap[mediatorName] = handle;
+        }
+    }];
+    return handle;
+}
+
 /**
 Check if a Mediator is registered or not
 
@@ -268,9 +543,9 @@ Check if a Mediator is registered or not
 */
 - (BOOL)hasMediator:(NSString *)mediatorName {
     __block BOOL exists = NO;
-    dispatch_sync(self.mediatorMapQueue, ^{
+    [self.mediatorMapLock read:^{
         exists = self.mediatorMap[mediatorName] != nil;
-    });
+    }];
     return exists;
 }
 
@@ -282,11 +557,12 @@ Remove an `IMediator` from the `View`.
 */
 - (nullable id<IMediator>)removeMediator:(NSString *)mediatorName {
     __block id<IMediator> mediator = nil;
-    dispatch_barrier_sync(self.mediatorMapQueue, ^{
+    [self.mediatorMapLock write:^{
         // remove the mediator from the map
         mediator = self.mediatorMap[mediatorName];
         [self.mediatorMap removeObjectForKey:mediatorName];
-    });
+        [self.handleMap[mediatorName] updateTarget:nil];
+    }];
     
     if (mediator == nil) return nil;
     
@@ -298,11 +574,119 @@ Remove an `IMediator` from the `View`.
         [self removeObserver:notificationName context:mediator];
     }
     
+    if (MemoryAccountingActive()) {
+        [self.memoryAccount recordRelease:MemoryCategoryMap bytes:MemoryAccountEntrySize];
+        if (interests.count > 0) [self.memoryAccount recordRelease:MemoryCategoryObserver bytes:MemoryAccountObserverSize()];
+    }
+    
     // alert the mediator that it has been removed
+    PUREMVC_PROBE2(mediator_remove, self.multitonKey.UTF8String, mediator.name.UTF8String);
     [mediator onRemove];
     return mediator;
 }
 
+/**
+Remove every `IMediator`, and the `IObserver`s linking them to
+their notification interests, from the `View`.
+
+The mediator map is swapped out in a single barrier and the
+mediators' observers are removed in a single barrier on the
+observer map, then each removed `IMediator` has its `onRemove`
+method called outside the locks. Observers registered by others,
+such as the `Controller`'s, are left in place.
+
+- returns: the mediators that were removed
+*/
+- (NSArray<id<IMediator>> *)removeAllMediators {
+    __block NSDictionary<NSString *, id<IMediator>> *mediators = nil;
+    __block NSDictionary<NSString *, Handle *> *handles = nil;
+    [self.mediatorMapLock write:^{
+        mediators = self.mediatorMap;
+        handles = self.handleMap;
+        self.mediatorMap = [NSMutableDictionary dictionary];
+        self.handleMap = [NSMutableDictionary dictionary];
+    }];
+    
+    // interests are collected outside the queues, mediators may call back into the View
+    NSArray<id<IMediator>> *removed = [mediators allValues];
+    NSMutableArray<NSArray *> *interests = [NSMutableArray arrayWithCapacity:removed.count];
+    for (id<IMediator> mediator in removed) {
+        [interests addObject:[mediator listNotificationInterests]];
+    }
+    
+    [self.observerMapLock write:^{
+        for (NSUInteger i = 0; i < removed.count; i++) {
+            for (NSString *notificationName in interests[i]) {
+                [self dropObserver:notificationName context:removed[i]];
+            }
+        }
+    }];
+    
+    if (MemoryAccountingActive()) {
+        size_t observers = 0;
+        for (NSArray *names in interests) {
+            if (names.count > 0) observers += MemoryAccountObserverSize();
+        }
+        [self.memoryAccount recordRelease:MemoryCategoryMap bytes:removed.count * MemoryAccountEntrySize];
+        [self.memoryAccount recordRelease:MemoryCategoryObserver bytes:observers];
+    }
+    
+    for (Handle *handle in [handles objectEnumerator]) {
+        [handle updateTarget:nil];
+    }
+    
+    for (id<IMediator> mediator in removed) {
+        PUREMVC_PROBE2(mediator_remove, self.multitonKey.UTF8String, mediator.name.UTF8String);
+        [mediator onRemove];
+    }
+    return removed;
+}
+
+/**
+Take a snapshot of the `View`'s registrations, for diagnostics.
+
+Both maps are copied while reading them together. No path waits
+for the mediator map while holding the observer map, so nesting
+the reads cannot deadlock. The copies are described outside the
+queues.
+
+- returns: the registrations, serializable with `NSJSONSerialization`
+*/
+- (NSDictionary<NSString *, id> *)introspect {
+    __block NSDictionary<NSString *, id<IMediator>> *mediators = nil;
+    NSMutableDictionary<NSString *, NSArray<id<IObserver>> *> *observerMap = [NSMutableDictionary dictionary];
+    [self.mediatorMapLock read:^{
+        mediators = [self.mediatorMap copy];
+        [self.observerMapLock read:^{
+            [self.observerMap enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSMutableArray<id<IObserver>> *observers, BOOL *stop) {
+                observerMap[name] = [observers copy];
+            }];
+        }];
+    }];
+    
+    NSMutableDictionary<NSString *, NSDictionary *> *notifications = [NSMutableDictionary dictionaryWithCapacity:observerMap.count];
+    [observerMap enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSArray<id<IObserver>> *observers, BOOL *stop) {
+        NSMutableArray<NSDictionary *> *contexts = [NSMutableArray arrayWithCapacity:observers.count];
+        NSUInteger live = 0;
+        for (id<IObserver> observer in observers) {
+            id context = observer.context;
+            if (context != nil) live++;
+            [contexts addObject:@{
+                @"class": context != nil ? NSStringFromClass([context class]) : [NSNull null],
+                @"alive": @(context != nil)
+            }];
+        }
+        notifications[name] = @{@"observers": @(observers.count), @"live": @(live), @"contexts": contexts};
+    }];
+    
+    NSMutableArray<NSDictionary *> *mediatorList = [NSMutableArray arrayWithCapacity:mediators.count];
+    for (NSString *name in [mediators.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+        [mediatorList addObject:@{@"name": name, @"class": NSStringFromClass([(id)mediators[name] class])}];
+    }
+    
+    return @{@"key": self.multitonKey, @"notifications": notifications, @"mediators": mediatorList};
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,199 @@
+//
+//  Watchdog.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <stdatomic.h>
+#import "Watchdog.h"
+#import "Instrumentation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface Watchdog()
+
+/// Budgets keyed by notification name, replaced whole under `@synchronized (self)`.
+@property (atomic, copy) NSDictionary<NSString *, NSNumber *> *notificationBudgets;
+
+/// Budgets keyed by context class, replaced whole under `@synchronized (self)`.
+@property (atomic, copy) NSDictionary<Class, NSNumber *> *classBudgets;
+
+@end
+
+/**
+Latency budgets of a Core's observers and commands.
+
+Budgets are read far more often than they are set, so each map is an
+immutable dictionary swapped on every change. The smallest budget is
+kept in `_threshold`, and a check within it returns without a lookup.
+*/
+@implementation Watchdog {
+    atomic_uint_fast64_t _defaultBudget;
+    /// The smallest budget set, UINT64_MAX when there is none.
+    atomic_uint_fast64_t _threshold;
+    atomic_uint_fast64_t _violationCount;
+}
+
++ (BOOL)isEnabled {
+#if PUREMVC_INSTRUMENTATION
+    return (InstrumentationActiveFlags() & InstrumentationFlagWatchdog) != 0;
+#else
+    return NO;
+#endif
+}
+
++ (void)setEnabled:(BOOL)enabled {
+#if PUREMVC_INSTRUMENTATION
+    InstrumentationSetFlag(InstrumentationFlagWatchdog, enabled);
+#endif
+}
+
+/**
+Factory method to create a `Watchdog` for a Core.
+
+- parameter key: the multiton key of the Core
+- returns: a watchdog without budgets
+*/
++ (instancetype)withKey:(NSString *)key {
+    return [[self alloc] initWithKey:key];
+}
+
+/**
+Constructor.
+
+- parameter key: the multiton key of the Core
+- returns: a watchdog without budgets
+*/
+- (instancetype)initWithKey:(NSString *)key {
+    if (self = [super init]) {
+        _multitonKey = [key copy];
+        _notificationBudgets = @{};
+        _classBudgets = @{};
+        atomic_init(&_defaultBudget, 0);
+        atomic_init(&_threshold, UINT64_MAX);
+        atomic_init(&_violationCount, 0);
+    }
+    return self;
+}
+
+- (uint64_t)defaultBudget {
+    return atomic_load_explicit(&_defaultBudget, memory_order_relaxed);
+}
+
+- (void)setDefaultBudget:(uint64_t)defaultBudget {
+    @synchronized (self) {
+        atomic_store_explicit(&_defaultBudget, defaultBudget, memory_order_relaxed);
+        [self updateThreshold];
+    }
+}
+
+- (uint64_t)violationCount {
+    return atomic_load_explicit(&_violationCount, memory_order_relaxed);
+}
+
+/**
+Set the budget of each delivery of a notification, and of its command.
+
+- parameter budget: the budget in nanoseconds, or 0 to remove it
+- parameter notificationName: the name of the notification
+*/
+- (void)setBudget:(uint64_t)budget forNotification:(NSString *)notificationName {
+    @synchronized (self) {
+        NSMutableDictionary<NSString *, NSNumber *> *budgets = [self.notificationBudgets mutableCopy];
+        budgets[notificationName] = budget != 0 ? @(budget) : nil;
+        self.notificationBudgets = budgets;
+        [self updateThreshold];
+    }
+}
+
+/**
+Set the budget of each delivery to observers whose context is of a
+class, and of each execution of a command of that class.
+
+- parameter budget: the budget in nanoseconds, or 0 to remove it
+- parameter contextClass: the class of the observer's context or of the command
+*/
+- (void)setBudget:(uint64_t)budget forContextClass:(Class)contextClass {
+    @synchronized (self) {
+        NSMutableDictionary<Class, NSNumber *> *budgets = [self.classBudgets mutableCopy];
+        budgets[(id<NSCopying>)contextClass] = budget != 0 ? @(budget) : nil;
+        self.classBudgets = budgets;
+        [self updateThreshold];
+    }
+}
+
+/**
+Remove every budget, including `defaultBudget`.
+*/
+- (void)removeAllBudgets {
+    @synchronized (self) {
+        self.notificationBudgets = @{};
+        self.classBudgets = @{};
+        atomic_store_explicit(&_defaultBudget, 0, memory_order_relaxed);
+        [self updateThreshold];
+    }
+}
+
+/**
+Recompute the smallest budget.
+
+Must be called inside `@synchronized (self)`.
+*/
+- (void)updateThreshold {
+    uint64_t threshold = UINT64_MAX;
+    uint64_t defaultBudget = atomic_load_explicit(&_defaultBudget, memory_order_relaxed);
+    if (defaultBudget != 0) threshold = defaultBudget;
+    for (NSNumber *budget in self.notificationBudgets.allValues) threshold = MIN(threshold, budget.unsignedLongLongValue);
+    for (NSNumber *budget in self.classBudgets.allValues) threshold = MIN(threshold, budget.unsignedLongLongValue);
+    atomic_store_explicit(&_threshold, threshold, memory_order_relaxed);
+}
+
+/**
+The budget applying to a delivery: its context class's, else its
+notification's, else the default.
+
+- parameter notificationName: the name of the notification
+- parameter contextClass: the class of the observer's context or of the command
+- returns: the budget in nanoseconds, or 0 for none
+*/
+- (uint64_t)budgetForNotification:(NSString *)notificationName contextClass:(Class)contextClass {
+    NSNumber *budget = self.classBudgets[(id<NSCopying>)contextClass] ?: self.notificationBudgets[notificationName];
+    return budget != nil ? budget.unsignedLongLongValue : atomic_load_explicit(&_defaultBudget, memory_order_relaxed);
+}
+
+/**
+Check a delivery against its budget, passing an overrun to `handler`,
+or logging it when there is none.
+
+- parameter notificationName: the name of the notification
+- parameter contextClass: the class of the observer's context or of the command
+- parameter latency: the time taken, in nanoseconds
+- returns: whether the budget was exceeded
+*/
+- (BOOL)checkNotification:(NSString *)notificationName contextClass:(Class)contextClass latency:(uint64_t)latency {
+    if (latency <= atomic_load_explicit(&_threshold, memory_order_relaxed)) return NO;
+    uint64_t budget = [self budgetForNotification:notificationName contextClass:contextClass];
+    if (budget == 0 || latency <= budget) return NO;
+    
+    atomic_fetch_add_explicit(&_violationCount, 1, memory_order_relaxed);
+    WatchdogHandler handler = self.handler;
+    if (handler != nil) {
+        handler(self.multitonKey, notificationName, contextClass, latency, budget);
+    } else {
+        NSLog(@"PureMVC Watchdog: %@ took %llu ns handling '%@' in Core '%@', over its budget of %llu ns",
+              NSStringFromClass(contextClass), (unsigned long long)latency, notificationName, self.multitonKey, (unsigned long long)budget);
+    }
+    return YES;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@ key=%@ violations=%llu>", NSStringFromClass([self class]), self.multitonKey,
+            (unsigned long long)self.violationCount];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -8,6 +8,8 @@
 
 #import <Foundation/Foundation.h>
 #import "MacroCommand.h"
+#import "Tracer.h"
+#import "MemoryAccount.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -119,9 +121,17 @@ order.
         id<ICommand> (^factory)(void) = self.subCommands[0];
         [self.subCommands removeObjectAtIndex:0];
         
-        id command = factory();
-        //[instance initializeNotifier:self.multitonKey];
+        id<ICommand> command = factory();
+        [command initializeNotifier:self.multitonKey];
+#if PUREMVC_INSTRUMENTATION
+        unsigned flags = InstrumentationActiveFlags();
+        uint64_t span = (flags & InstrumentationFlagTrace) != 0 ? [Tracer beginSpan:TraceCategorySubCommand name:[(id)command class] core:nil] : 0;
+        if ((flags & InstrumentationFlagMemory) != 0) [MemoryAccount.current recordTransient:MemoryCategoryCommand bytes:MemoryAccountSize(command)];
+#endif
         [command execute:notification];
+#if PUREMVC_INSTRUMENTATION
+        if (span != 0) [Tracer endSpan:span];
+#endif
     }
 }
 
@@ -0,0 +1,161 @@
+//
+//  CoreTemplate.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import "CoreTemplate.h"
+#import "Facade.h"
+#import "Model.h"
+#import "View.h"
+#import "Controller.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface CoreTemplate()
+
+/// The classes of the captured Core actors, instantiated for every new Core.
+@property (nonatomic, strong) Class facadeClass;
+@property (nonatomic, strong) Class modelClass;
+@property (nonatomic, strong) Class viewClass;
+@property (nonatomic, strong) Class controllerClass;
+
+/// `ICommand` factories keyed by notification name, shared by every new Core.
+@property (nonatomic, copy) NSDictionary<NSString *, id<ICommand> (^)(void)> *commands;
+
+/// Proxy factories keyed by Proxy name, shared by every new Core.
+@property (nonatomic, copy) NSDictionary<NSString *, id<IProxy> (^)(void)> *proxyFactories;
+
+/// Prototype mediators, copied into every new Core.
+@property (nonatomic, copy) NSArray<id<IMediator>> *mediators;
+
+@end
+
+/**
+An immutable capture of an initialized Core.
+
+`@see Facade`
+*/
+@implementation CoreTemplate
+
+/**
+Create a template of the Core registered under a key.
+
+- parameter key: the multiton key of an initialized Core
+- returns: a new `CoreTemplate`
+*/
++ (instancetype)withKey:(NSString *)key {
+    return [[CoreTemplate alloc] initWithKey:key];
+}
+
+/**
+Constructor.
+
+The Core is captured once, later changes to it are not
+reflected in the template.
+
+- parameter key: the multiton key of an initialized Core
+
+@throws Error if the Core cannot be captured
+*/
+- (instancetype)initWithKey:(NSString *)key {
+    if (![Facade hasCore:key]) {
+        [NSException raise:@"CoreTemplateException" format:@"No Core exists for key '%@'.", key];
+    }
+    
+    id<IFacade> facade = [Facade getInstance:key factory:^(NSString *multitonKey) { return [Facade withKey:multitonKey]; }];
+    id<IModel> model = [Model getInstance:key factory:^(NSString *multitonKey) { return [Model withKey:multitonKey]; }];
+    id<IView> view = [View getInstance:key factory:^(NSString *multitonKey) { return [View withKey:multitonKey]; }];
+    id<IController> controller = [Controller getInstance:key factory:^(NSString *multitonKey) { return [Controller withKey:multitonKey]; }];
+    
+    if (![(id)model isKindOfClass:[Model class]] || ![(id)view isKindOfClass:[View class]] || ![(id)controller isKindOfClass:[Controller class]]) {
+        [NSException raise:@"CoreTemplateException" format:@"The Core for key '%@' does not use Model, View and Controller.", key];
+    }
+    
+    if (self = [super init]) {
+        _facadeClass = [(id)facade class];
+        _modelClass = [(id)model class];
+        _viewClass = [(id)view class];
+        _controllerClass = [(id)controller class];
+        _commands = [(Controller *)controller commands];
+        
+        // registered proxies become factories of copies, unless a factory is already registered
+        NSMutableDictionary<NSString *, id<IProxy> (^)(void)> *proxyFactories = [[(Model *)model proxyFactories] mutableCopy];
+        for (id<IProxy> proxy in [(Model *)model proxies]) {
+            if (proxyFactories[proxy.name] != nil) continue;
+            id<IProxy> prototype = [CoreTemplate prototypeOf:proxy key:key];
+            proxyFactories[proxy.name] = [^id<IProxy> { return [(id)prototype copy]; } copy];
+        }
+        _proxyFactories = proxyFactories;
+        
+        NSMutableArray<id<IMediator>> *mediators = [NSMutableArray array];
+        for (id<IMediator> mediator in [(View *)view mediators]) {
+            [mediators addObject:[CoreTemplate prototypeOf:mediator key:key]];
+        }
+        _mediators = mediators;
+    }
+    return self;
+}
+
+/**
+Copy a registered `IProxy` or `IMediator`.
+
+- parameter registrant: the instance to copy
+- parameter key: the multiton key of the captured Core, for the error message
+- returns: the copy
+
+@throws Error if the instance does not adopt `NSCopying`
+*/
++ (id)prototypeOf:(id<INotifier>)registrant key:(NSString *)key {
+    if (![(id)registrant conformsToProtocol:@protocol(NSCopying)]) {
+        [NSException raise:@"CoreTemplateException" format:@"'%@' in the Core for key '%@' does not adopt NSCopying.", NSStringFromClass([(id)registrant class]), key];
+    }
+    return [(id)registrant copy];
+}
+
+/**
+Create and register a new Core from this template.
+
+The `View`, `Model` and `Controller` are created first, seeded with
+the shared maps, so the `Facade` finds them already registered when
+it initializes. The prototype mediators are then copied and
+registered in bulk.
+
+- parameter key: the multiton key for the new Core
+- returns: the `IFacade` of the new Core
+
+@throws Error if a Core already exists for `key`
+*/
+- (id<IFacade>)instantiateWithKey:(NSString *)key {
+    if ([Facade hasCore:key]) {
+        [NSException raise:@"CoreTemplateException" format:@"A Core already exists for key '%@'.", key];
+    }
+    
+    id<IView> view = [View getInstance:key factory:^(NSString *multitonKey) {
+        return (id<IView>)[[self.viewClass alloc] initWithKey:multitonKey];
+    }];
+    [Model getInstance:key factory:^(NSString *multitonKey) {
+        return (id<IModel>)[[self.modelClass alloc] initWithKey:multitonKey proxyFactories:self.proxyFactories];
+    }];
+    [Controller getInstance:key factory:^(NSString *multitonKey) {
+        return (id<IController>)[[self.controllerClass alloc] initWithKey:multitonKey commands:self.commands];
+    }];
+    id<IFacade> facade = [Facade getInstance:key factory:^(NSString *multitonKey) {
+        return (id<IFacade>)[[self.facadeClass alloc] initWithKey:multitonKey];
+    }];
+    
+    NSMutableArray<id<IMediator>> *mediators = [NSMutableArray arrayWithCapacity:self.mediators.count];
+    for (id<IMediator> mediator in self.mediators) {
+        [mediators addObject:[(id)mediator copy]];
+    }
+    [(View *)view registerMediators:mediators];
+    
+    return facade;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -12,10 +12,19 @@
 #import "Model.h"
 #import "View.h"
 #import "Notification.h"
+#import "MultitonRegistry.h"
+#import "Pipe.h"
+#import "Bus.h"
+#import "MemoryAccount.h"
+#import "MapLock.h"
+#import <stdatomic.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface Facade()
+@interface Facade() {
+    // Set by removeCore once this Facade's Core is removed
+    atomic_bool _removed;
+}
 
 /// The unique Multiton key for this Facade instance.
 @property (nonatomic, copy, readonly) NSString *multitonKey;
@@ -29,16 +38,22 @@ NS_ASSUME_NONNULL_BEGIN
 /// Reference to the View instance for this Facade.
 @property (nonatomic, strong, nullable) id<IView> view;
 
+/// Memory attributed to this Core, created on first use.
+@property (nonatomic, strong, readonly) MemoryAccount *memoryAccount;
+
+/// Storage of `memoryAccount`, nil until first use.
+@property (atomic, strong, nullable) MemoryAccount *account;
+
 @end
 
 // Static dictionary storing all Facade instances keyed by multitonKey.
-static NSMutableDictionary<NSString *, id<IFacade>> *instanceMap = nil;
+static MultitonRegistry<id<IFacade>> *instanceMap = nil;
 
 // Automatically invoked when the module loads.
 // Initializes the static instanceMap dictionary.
 __attribute__((constructor()))
 static void initialize(void) {
-    instanceMap = [NSMutableDictionary dictionary];
+    instanceMap = [MultitonRegistry registry];
 }
 
 /**
@@ -60,12 +75,7 @@ Facade Multiton Factory method
 - returns: the Multiton instance of the `IFacade`
 */
 + (id<IFacade>)getInstance:(NSString *)key factory:(id<IFacade> (^)(NSString *key))factory {
-    @synchronized (instanceMap) {
-        if (instanceMap[key] == nil) {
-            instanceMap[key] = factory(key);
-        }
-        return instanceMap[key];
-    }
+    return [instanceMap objectForKey:key factory:factory];
 }
 
 /**
@@ -75,23 +85,49 @@ Check if a Core is registered or not
 - returns: whether a Core is registered with the given `key`.
 */
 + (BOOL)hasCore:(NSString *)key {
-    @synchronized (instanceMap) {
-        return instanceMap[key] != nil;
-    }
+    return [instanceMap objectForKey:key] != nil;
+}
+
+/**
+The Facade of a Core, if it has one.
+
+- parameter key: the multiton key for the Core in question
+- returns: the Multiton instance, or nil
+*/
++ (nullable id<IFacade>)facadeForKey:(NSString *)key {
+    return [instanceMap objectForKey:key];
 }
 
 /**
 Remove a Core.
 
 Remove the Model, View, Controller and Facade
-instances for the given key.
+instances for the given key, unsubscribe it from
+the Bus, close its inbound Pipe, drop its
+`MemoryAccount` and forget its `MapLockStrategy`.
 
 - parameter key: multitonKey of the Core to remove
 */
 + (void)removeCore:(NSString *)key {
-    @synchronized (instanceMap) {
-        [instanceMap removeObjectForKey:key];
-    }
+    // registrants are torn down while the Facade is still registered, so their onRemove can reach it
+    [Bus unsubscribeCore:key];
+    [Pipe removePipe:key];
+    [Model removeModel:key];
+    [Controller removeController:key];
+    [View removeView:key];
+    [MemoryAccount removeAccount:key];
+    [MapLock removeStrategyForCore:key];
+    id<IFacade> facade = [instanceMap removeObjectForKey:key];
+    if ([(id)facade isKindOfClass:[Facade class]]) atomic_store_explicit(&((Facade *)facade)->_removed, true, memory_order_release);
+}
+
+/**
+Whether this Facade's Core has been removed with `removeCore`.
+
+- returns: `YES` once the Core is removed
+*/
+- (BOOL)isRemoved {
+    return atomic_load_explicit(&_removed, memory_order_acquire);
 }
 
 /**
@@ -106,6 +142,33 @@ instances for the given key.
     return [[Facade alloc] initWithKey:key];
 }
 
+/**
+Create a Core confined to the calling thread.
+
+Its `Model`, `View` and `Controller` access their maps without
+synchronization, so the Core must only be used from this thread.
+
+- parameter key: the multiton key of the Core
+- returns: a new instance of the receiving class, confined to the calling thread
+*/
++ (instancetype)confinedWithKey:(NSString *)key {
+    return [self withKey:key mapLockStrategy:MapLockStrategyConfined];
+}
+
+/**
+Create a Core whose `Model`, `View` and `Controller` synchronize
+their maps with a given strategy.
+
+- parameter key: the multiton key of the Core
+- parameter strategy: the `MapLockStrategy` of the Core's maps
+- returns: a new instance of the receiving class
+*/
++ (instancetype)withKey:(NSString *)key mapLockStrategy:(MapLockStrategy)strategy {
+    // an existing Core is left as is, initWithKey: raises for it
+    if ([instanceMap objectForKey:key] == nil) [MapLock setStrategy:strategy forCore:key];
+    return [[self alloc] initWithKey:key];
+}
+
 /**
 Constructor.
 
@@ -119,17 +182,31 @@ that returns the `IFacade` implementation.
 @throws Error Error if instance for this Multiton key has already been constructed
 */
 - (instancetype)initWithKey:(NSString *)key {
-    if (instanceMap[key] != nil) {
+    if ([instanceMap objectForKey:key] != nil) {
         [NSException raise:@"FacadeAlreadyExistsException" format:@"A Facade instance already exists for key '%@'.", key];
     }
     if (self = [super init]) {
         [self initializeNotifier:key];
         [instanceMap setObject:self forKey:key];
+        // Memory attributed to this Core, created now only while MemoryAccount is enabled
+        if (MemoryAccountingActive()) [self memoryAccount];
         [self initializeFacade];
     }
     return self;
 }
 
+/**
+The `MemoryAccount` of this Core, created on first use so that Cores
+never accounted for do not register one.
+
+- returns: the account shared with the Core's other actors
+*/
+- (MemoryAccount *)memoryAccount {
+    MemoryAccount *account = self.account;
+    if (account == nil) self.account = account = [MemoryAccount getInstance:self.multitonKey];
+    return account;
+}
+
 /**
 Initialize the Multiton `Facade` instance.
 
@@ -247,6 +324,16 @@ Register an `IProxy` with the `Model` by name.
     [self.model registerProxy:proxy];
 }
 
+/**
+Register a factory that lazily creates an `IProxy` with the `Model`.
+
+- parameter factory: closure that returns the `IProxy` instance
+- parameter proxyName: the name the `IProxy` will be registered under
+*/
+- (void)registerProxyFactory:(id<IProxy> (^)(void))factory name:(NSString *)proxyName {
+    [self.model registerProxyFactory:factory name:proxyName];
+}
+
 /**
 Retrieve an `IProxy` from the `Model` by name.
 
@@ -257,6 +344,16 @@ Retrieve an `IProxy` from the `Model` by name.
     return [self.model retrieveProxy:proxyName];
 }
 
+/**
+Retrieve a handle that tracks the `IProxy` registered under a name.
+
+- parameter proxyName: the name of the `IProxy` to track
+- returns: the handle whose `target` is the currently registered `IProxy`.
+*/
+- (id<IHandle>)retrieveProxyHandle:(NSString *)proxyName {
+    return [self.model retrieveProxyHandle:proxyName];
+}
+
 /**
 Check if a Proxy is registered
 
@@ -277,6 +374,26 @@ Remove an `IProxy` from the `Model` by name.
     return [self.model removeProxy:proxyName];
 }
 
+/**
+Get the loading state of an `IProxy` in the `Model`.
+
+- parameter proxyName: the name of the `IProxy`
+- returns: the `ProxyReadiness` of the `IProxy`
+*/
+- (ProxyReadiness)proxyReadiness:(NSString *)proxyName {
+    return [self.model proxyReadiness:proxyName];
+}
+
+/**
+Wait, without blocking, for a set of proxies in the `Model` to finish loading.
+
+- parameter proxyNames: the names of the proxies to wait for
+- parameter completion: called once all of them have finished loading
+*/
+- (void)awaitProxies:(NSArray<NSString *> *)proxyNames completion:(void (^)(void))completion {
+    [self.model awaitProxies:proxyNames completion:completion];
+}
+
 /**
 Register a `IMediator` with the `View`.
 
@@ -296,6 +413,16 @@ Retrieve an `IMediator` from the `View`.
     return [self.view retrieveMediator:mediatorName];
 }
 
+/**
+Retrieve a handle that tracks the `IMediator` registered under a name.
+
+- parameter mediatorName: the name of the `IMediator` to track
+- returns: the handle whose `target` is the currently registered `IMediator`.
+*/
+- (id<IHandle>)retrieveMediatorHandle:(NSString *)mediatorName {
+    return [self.view retrieveMediatorHandle:mediatorName];
+}
+
 /**
 Check if a Mediator is registered or not
 
@@ -333,6 +460,20 @@ construct the notification yourself.
     [self.view notifyObservers:notification];
 }
 
+/**
+Take a snapshot of the Core's registrations, for diagnostics.
+
+- returns: the `introspect` snapshots of the `Model`, `View` and `Controller`, keyed by actor
+*/
+- (NSDictionary<NSString *, id> *)introspect {
+    return @{
+        @"key": self.multitonKey,
+        @"model": self.model != nil ? [self.model introspect] : [NSNull null],
+        @"view": self.view != nil ? [self.view introspect] : [NSNull null],
+        @"controller": self.controller != nil ? [self.controller introspect] : [NSNull null]
+    };
+}
+
 /**
 Set the Multiton key for this facade instance.
 
@@ -356,7 +497,9 @@ instances in our implementation code.
 - parameter type: the type of the notification
 */
 - (void)sendNotification:(NSString *)notificationName body:(nullable id)body type:(nullable NSString *)type {
-    [self notifyObservers:[Notification withName:notificationName body:body type:type]];
+    id<INotification> notification = [Notification withName:notificationName body:body type:type];
+    if (MemoryAccountingActive()) [self.memoryAccount recordTransient:MemoryCategoryNotification bytes:MemoryAccountSize(notification)];
+    [self notifyObservers:notification];
 }
 
 /**
@@ -0,0 +1,277 @@
+//
+//  NotificationCodec.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import "NotificationCodec.h"
+#import "Notification.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Flags of an encoded notification.
+typedef NS_OPTIONS(uint8_t, NotificationCodecFlags) {
+    NotificationCodecFlagsType = 1 << 0,
+    NotificationCodecFlagsBody = 1 << 1,
+    NotificationCodecFlagsBodyCodec = 1 << 2
+};
+
+/// Encoded notification header: version, flags, reserved.
+typedef struct {
+    uint8_t version;
+    uint8_t flags;
+    uint16_t reserved;
+} NotificationCodecHeader;
+
+@interface NotificationCodec()
+
+/// IDs of the interned strings.
+@property (nonatomic, copy) NSDictionary<NSString *, NSNumber *> *nameIDs;
+
+@end
+
+/**
+A versioned, compact binary encoding of `INotification`.
+
+The encoding is a `NotificationCodecHeader`, followed by the name,
+the type if present and the body if present. A name or type is a
+little-endian 4 byte ID, or an ID of 0 followed by a 4 byte length
+and the UTF-8 bytes. A body is a 4 byte length followed by its bytes.
+
+`@see IBodyCodec`
+*/
+@implementation NotificationCodec
+
+/// The version of the encoding.
++ (uint8_t)VERSION { return 1; }
+
+/**
+Create a codec without interned strings or a body codec.
+
+- returns: a new `NotificationCodec`
+*/
++ (instancetype)codec {
+    return [[NotificationCodec alloc] initWithNames:@[] bodyCodec:nil];
+}
+
+/**
+Create a codec.
+
+- parameter names: the notification names and types to intern
+- parameter bodyCodec: the codec for bodies that are not `NSData`
+- returns: a new `NotificationCodec`
+*/
++ (instancetype)withNames:(NSArray<NSString *> *)names bodyCodec:(nullable id<IBodyCodec>)bodyCodec {
+    return [[NotificationCodec alloc] initWithNames:names bodyCodec:bodyCodec];
+}
+
+/**
+Constructor.
+
+- parameter names: the notification names and types to intern
+- parameter bodyCodec: the codec for bodies that are not `NSData`
+*/
+- (instancetype)initWithNames:(NSArray<NSString *> *)names bodyCodec:(nullable id<IBodyCodec>)bodyCodec {
+    if (self = [super init]) {
+        _names = [names copy];
+        _bodyCodec = bodyCodec;
+        NSMutableDictionary<NSString *, NSNumber *> *nameIDs = [NSMutableDictionary dictionaryWithCapacity:names.count];
+        [names enumerateObjectsUsingBlock:^(NSString *name, NSUInteger index, BOOL *stop) {
+            if (nameIDs[name] == nil) nameIDs[name] = @(index + 1);
+        }];
+        _nameIDs = nameIDs;
+    }
+    return self;
+}
+
+/**
+Encode a notification.
+
+- parameter notification: the notification to encode
+- returns: the encoded bytes
+*/
+- (NSData *)encode:(id<INotification>)notification {
+    NSMutableData *buffer = [NSMutableData dataWithCapacity:64];
+    [self encode:notification into:buffer];
+    return buffer;
+}
+
+/**
+Encode a notification, appending it to a buffer.
+
+- parameter notification: the notification to encode
+- parameter buffer: the buffer to append to
+*/
+- (void)encode:(id<INotification>)notification into:(NSMutableData *)buffer {
+    NotificationCodecHeader header = { [NotificationCodec VERSION], 0, 0 };
+    NSData *body = nil;
+    if (notification.type != nil) header.flags |= NotificationCodecFlagsType;
+    if ([notification.body isKindOfClass:[NSData class]]) {
+        body = notification.body;
+        header.flags |= NotificationCodecFlagsBody;
+    } else if (notification.body != nil) {
+        body = [self.bodyCodec encodeBody:notification.body];
+        if (body == nil) {
+            [NSException raise:@"NotificationCodecException" format:@"No body codec for the body of notification '%@'.", notification.name];
+        }
+        header.flags |= NotificationCodecFlagsBody | NotificationCodecFlagsBodyCodec;
+    }
+    
+    [buffer appendBytes:&header length:sizeof(header)];
+    [self encodeString:notification.name into:buffer];
+    if (notification.type != nil) [self encodeString:notification.type into:buffer];
+    if (body != nil) {
+        uint32_t length = NSSwapHostIntToLittle((uint32_t)body.length);
+        [buffer appendBytes:&length length:sizeof(length)];
+        [buffer appendData:body];
+    }
+}
+
+/**
+Encode a name or type, as its ID if it is interned.
+
+- parameter string: the string to encode
+- parameter buffer: the buffer to append to
+*/
+- (void)encodeString:(NSString *)string into:(NSMutableData *)buffer {
+    uint32_t identifier = NSSwapHostIntToLittle([self.nameIDs[string] unsignedIntValue]);
+    [buffer appendBytes:&identifier length:sizeof(identifier)];
+    if (identifier != 0) return;
+    
+    NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    uint32_t encodedLength = NSSwapHostIntToLittle((uint32_t)length);
+    [buffer appendBytes:&encodedLength length:sizeof(encodedLength)];
+    NSUInteger offset = buffer.length;
+    [buffer increaseLengthBy:length];
+    [string getBytes:(uint8_t *)buffer.mutableBytes + offset maxLength:length usedLength:NULL encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:NULL];
+}
+
+/**
+Decode a notification.
+
+- parameter data: the encoded bytes
+- parameter error: on failure, the reason the bytes could not be decoded
+- returns: the notification, or nil on failure
+*/
+- (nullable id<INotification>)decode:(NSData *)data error:(NSError **)error {
+    // the body slices the buffer, which must not change underneath it
+    if ([data isKindOfClass:[NSMutableData class]]) data = [data copy];
+    return [self decodeBytes:data.bytes length:data.length owner:data error:error];
+}
+
+/**
+Decode a notification from dispatch data.
+
+The data is mapped contiguously, which does not copy it if it
+already is, and the body is a slice of the mapping.
+
+- parameter data: the encoded bytes
+- parameter error: on failure, the reason the bytes could not be decoded
+- returns: the notification, or nil on failure
+*/
+- (nullable id<INotification>)decodeDispatchData:(dispatch_data_t)data error:(NSError **)error {
+    const void *bytes = NULL;
+    size_t length = 0;
+    dispatch_data_t map = dispatch_data_create_map(data, &bytes, &length);
+    return [self decodeBytes:bytes length:length owner:map error:error];
+}
+
+/**
+Decode a notification from a buffer.
+
+- parameter bytes: the encoded bytes
+- parameter length: the number of encoded bytes
+- parameter owner: the object owning the bytes, kept alive by the body
+- parameter error: on failure, the reason the bytes could not be decoded
+- returns: the notification, or nil on failure
+*/
+- (nullable id<INotification>)decodeBytes:(const uint8_t *)bytes length:(NSUInteger)length owner:(id)owner error:(NSError **)error {
+    NotificationCodecHeader header;
+    if (length < sizeof(header)) return [self decodeError:error reason:@"truncated header"];
+    memcpy(&header, bytes, sizeof(header));
+    if (header.version != [NotificationCodec VERSION]) return [self decodeError:error reason:@"unsupported version"];
+    
+    NSUInteger offset = sizeof(header);
+    NSString *name = [self decodeString:bytes length:length offset:&offset];
+    if (name == nil) return [self decodeError:error reason:@"invalid name"];
+    
+    NSString *type = nil;
+    if (header.flags & NotificationCodecFlagsType) {
+        type = [self decodeString:bytes length:length offset:&offset];
+        if (type == nil) return [self decodeError:error reason:@"invalid type"];
+    }
+    
+    id body = nil;
+    if (header.flags & NotificationCodecFlagsBody) {
+        uint32_t bodyLength;
+        if (length - offset < sizeof(bodyLength)) return [self decodeError:error reason:@"truncated body"];
+        memcpy(&bodyLength, bytes + offset, sizeof(bodyLength));
+        bodyLength = NSSwapLittleIntToHost(bodyLength);
+        offset += sizeof(bodyLength);
+        if (length - offset < bodyLength) return [self decodeError:error reason:@"truncated body"];
+        
+        // the deallocator captures the owner, keeping the bytes alive for as long as the slice
+        body = [[NSData alloc] initWithBytesNoCopy:(void *)(bytes + offset) length:bodyLength deallocator:^(void *slice, NSUInteger sliceLength) {
+            (void)owner;
+        }];
+        offset += bodyLength;
+        
+        if (header.flags & NotificationCodecFlagsBodyCodec) {
+            body = [self.bodyCodec decodeBody:body];
+            if (body == nil) return [self decodeError:error reason:@"body not decoded by the body codec"];
+        }
+    }
+    
+    return [Notification withName:name body:body type:type];
+}
+
+/**
+Decode a name or type.
+
+- parameter bytes: the encoded bytes
+- parameter length: the number of encoded bytes
+- parameter offset: the offset of the string, advanced past it
+- returns: the string, or nil if it is not valid
+*/
+- (nullable NSString *)decodeString:(const uint8_t *)bytes length:(NSUInteger)length offset:(NSUInteger *)offset {
+    uint32_t identifier;
+    if (length - *offset < sizeof(identifier)) return nil;
+    memcpy(&identifier, bytes + *offset, sizeof(identifier));
+    identifier = NSSwapLittleIntToHost(identifier);
+    *offset += sizeof(identifier);
+    if (identifier != 0) return identifier <= self.names.count ? self.names[identifier - 1] : nil;
+    
+    uint32_t stringLength;
+    if (length - *offset < sizeof(stringLength)) return nil;
+    memcpy(&stringLength, bytes + *offset, sizeof(stringLength));
+    stringLength = NSSwapLittleIntToHost(stringLength);
+    *offset += sizeof(stringLength);
+    if (length - *offset < stringLength) return nil;
+    
+    NSString *string = [[NSString alloc] initWithBytes:bytes + *offset length:stringLength encoding:NSUTF8StringEncoding];
+    *offset += stringLength;
+    return string;
+}
+
+/**
+Report bytes that are not a valid encoded notification.
+
+- parameter error: receives the error, if not NULL
+- parameter reason: what is wrong with the bytes
+- returns: nil, for convenience
+*/
+- (nullable id)decodeError:(NSError **)error reason:(NSString *)reason {
+    if (error != NULL) {
+        *error = [NSError errorWithDomain:@"org.puremvc.codec" code:1 userInfo:@{
+            NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Invalid encoded notification: %@.", reason]
+        }];
+    }
+    return nil;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -14,7 +14,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface Notifier()
 
-@property (nonatomic, copy, readonly) NSString *multitonKey;
+// Facade of multitonKey resolved by initializeNotifier, written only there;
+// weak, so a registrant kept after removeCore does not keep the Core alive
+@property (nonatomic, weak, nullable) Facade *cachedFacade;
 
 @end
 
@@ -56,12 +58,24 @@ The multitonKey is set:
 */
 @implementation Notifier
 
-/// Reference to the Facade Multiton
+/**
+Reference to the Facade Multiton
+
+The Facade of an existing Core is resolved once, by
+`initializeNotifier`, and returned until that Core is
+removed with `Facade.removeCore`; a Core created again
+under the same key is then looked up on every access.
+Removing any other Core leaves the cache in place.
+*/
 - (nullable id<IFacade>)facade {
     if (self.multitonKey == nil) {
         // Message constant
         [NSException raise:@"MultitonException" format:@"multitonKey for this Notifier not yet initialized!"];
     }
+    
+    Facade *facade = self.cachedFacade;
+    if (facade != nil && !facade.isRemoved) return facade;
+    
     // returns instance mapped to multitonKey if it exists otherwise defaults to Facade
     return [Facade getInstance:self.multitonKey factory:^(NSString *key) { return [Facade withKey:key]; }];
 }
@@ -81,10 +95,16 @@ soon as possible. They CANNOT access the facade
 in their constructors, since this method will not
 yet have been called.
 
+If the Core already exists its Facade is cached here,
+before the notifier is shared with other threads, so
+reading the cache needs no synchronization.
+
 - parameter key: the multitonKey for this INotifier to use
 */
 - (void)initializeNotifier:(NSString *)key {
     _multitonKey = key;
+    id<IFacade> facade = [Facade facadeForKey:key];
+    self.cachedFacade = [(id)facade isKindOfClass:[Facade class]] ? (Facade *)facade : nil;
 }
 
 /**
@@ -98,7 +118,7 @@ instances in our implementation code.
 - parameter type: the type of the notification (optional)
 */
 - (void)sendNotification:(NSString *)notificationName body:(nullable id)body type:(nullable NSString *)type {
-    [self sendNotification:notificationName body:body type:type];
+    [self.facade sendNotification:notificationName body:body type:type];
 }
 
 /**
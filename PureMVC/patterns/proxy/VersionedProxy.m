@@ -0,0 +1,79 @@
+//
+//  VersionedProxy.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import "VersionedProxy.h"
+#import "VersionedReference.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface VersionedProxy()
+
+/// The versioned reference holding the data.
+@property (nonatomic, strong, readonly) VersionedReference *reference;
+
+@end
+
+/**
+A `Proxy` whose data is an immutable, versioned snapshot.
+
+Reading `data` pins the current version through a `VersionedReference`
+without taking a lock, so readers on many threads don't contend with
+each other. Assigning `data` publishes the next version.
+
+`@see Proxy`
+`@see VersionedReference`
+*/
+@implementation VersionedProxy
+
+/// Constructor
+- (instancetype)initWithName:(nullable NSString *)name data:(nullable id)data {
+    if (self = [super initWithName:name data:nil]) {
+        _reference = [VersionedReference withValue:data];
+    }
+    return self;
+}
+
+/// The current data.
+- (nullable id)data {
+    return [self.reference load];
+}
+
+/// Publish new data as the next version.
+- (void)setData:(nullable id)data {
+    [self.reference store:data];
+}
+
+/// The version of the current data.
+- (uint64_t)version {
+    return self.reference.version;
+}
+
+/**
+Pin the current data together with its version.
+
+- parameter version: receives the version of the returned data, if not NULL
+- returns: the current data
+*/
+- (nullable id)dataWithVersion:(nullable uint64_t *)version {
+    return [self.reference loadWithVersion:version];
+}
+
+/**
+Publish new data derived from the current data.
+
+- parameter block: returns the new data given the current data
+- returns: the version of the published data
+*/
+- (uint64_t)updateData:(id _Nullable (^)(id _Nullable data))block {
+    return [self.reference update:block];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
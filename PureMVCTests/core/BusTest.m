@@ -0,0 +1,112 @@
+//
+//  BusTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import <stdatomic.h>
+
+@interface BusTest : XCTestCase
+
+@end
+
+@implementation BusTest {
+    /// Notifications received by the observers, across Cores.
+    NSMutableArray<id<INotification>> *_notifications;
+    
+    /// Number of notifications received, and the number awaited.
+    atomic_long _received;
+    atomic_long _expected;
+    
+    /// Signaled once the awaited number of notifications is received.
+    dispatch_semaphore_t _done;
+}
+
+- (void)setUp {
+    _notifications = [NSMutableArray array];
+    atomic_store(&_received, 0);
+    atomic_store(&_expected, 0);
+    _done = dispatch_semaphore_create(0);
+}
+
+/**
+Observer recording each notification, from any Core's executor.
+*/
+- (void)onRecord:(id<INotification>)notification {
+    @synchronized (_notifications) {
+        [_notifications addObject:notification];
+    }
+    [self onCount:notification];
+}
+
+/**
+Observer counting notifications, signaling once the awaited number is received.
+*/
+- (void)onCount:(id<INotification>)notification {
+    if (atomic_fetch_add(&_received, 1) + 1 == atomic_load(&_expected)) dispatch_semaphore_signal(_done);
+}
+
+/**
+Create Cores observing a notification.
+
+- parameter prefix: the multiton key prefix of the Cores
+- parameter count: the number of Cores
+- parameter notify: the observer selector
+- returns: the multiton keys of the Cores
+*/
+- (NSArray<NSString *> *)cores:(NSString *)prefix count:(int)count notify:(SEL)notify {
+    NSMutableArray<NSString *> *keys = [NSMutableArray array];
+    for (int i = 0; i < count; i++) {
+        NSString *key = [NSString stringWithFormat:@"%@%d", prefix, i];
+        [Facade getInstance:key factory:^(NSString *multitonKey) { return [Facade withKey:multitonKey]; }];
+        [[View getInstance:key factory:^(NSString *multitonKey) { return [View withKey:multitonKey]; }] registerObserver:@"BusTestNote" observer:[Observer withNotify:notify context:self]];
+        [keys addObject:key];
+    }
+    return keys;
+}
+
+/**
+Tests that a published notification reaches every subscribed Core as the same instance
+*/
+- (void)testPublish {
+    NSArray<NSString *> *keys = [self cores:@"BusTestKey1_" count:3 notify:@selector(onRecord:)];
+    for (NSString *key in keys) [Bus subscribe:key topic:@"BusTestTopic"];
+    [Bus subscribe:keys[0] topic:@"BusTestTopic"];
+    XCTAssertTrue([Bus isSubscribed:keys[0] topic:@"BusTestTopic"], @"Expecting core subscribed");
+    
+    id<INotification> notification = [Notification withName:@"BusTestNote" body:@"config"];
+    atomic_store(&_expected, 3);
+    XCTAssertEqual([Bus publish:notification topic:@"BusTestTopic"], (NSUInteger)3, @"Expecting 3 deliveries, subscribing twice has no effect");
+    XCTAssertEqual(dispatch_semaphore_wait(_done, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0L, @"Expecting 3 notifications");
+    
+    for (id<INotification> received in _notifications) {
+        XCTAssertTrue(received == notification, @"Expecting the published instance");
+    }
+    XCTAssertEqual([Bus publish:notification topic:@"BusTestOtherTopic"], (NSUInteger)0, @"Expecting no deliveries");
+    
+    for (NSString *key in keys) [Facade removeCore:key];
+}
+
+/**
+Tests unsubscribing from a topic, and that removing a Core unsubscribes it
+*/
+- (void)testUnsubscribe {
+    NSArray<NSString *> *keys = [self cores:@"BusTestKey2_" count:3 notify:@selector(onCount:)];
+    for (NSString *key in keys) [Bus subscribe:key topic:@"BusTestTopic"];
+    
+    [Bus unsubscribe:keys[0] topic:@"BusTestTopic"];
+    XCTAssertFalse([Bus isSubscribed:keys[0] topic:@"BusTestTopic"], @"Expecting core unsubscribed");
+    
+    [Facade removeCore:keys[1]];
+    XCTAssertFalse([Bus isSubscribed:keys[1] topic:@"BusTestTopic"], @"Expecting removed core unsubscribed");
+    
+    XCTAssertEqual([Bus publish:[Notification withName:@"BusTestNote"] topic:@"BusTestTopic"], (NSUInteger)1, @"Expecting 1 delivery");
+    
+    for (NSString *key in keys) [Facade removeCore:key];
+}
+
+@end
@@ -0,0 +1,74 @@
+//
+//  ConfinementTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import "ControllerTestCommand.h"
+#import "ControllerTestVO.h"
+
+@interface ConfinementTest : XCTestCase
+
+@end
+
+@implementation ConfinementTest
+
+/**
+Tests that a confined Core registers, retrieves, notifies and executes like a shared one.
+*/
+- (void)testConfinedCore {
+    id<IFacade> facade = [Facade getInstance:@"ConfinementTestKey1" factory:^(NSString *key) { return [Facade confinedWithKey:key]; }];
+    Confinement *confinement = [Confinement confinementForKey:@"ConfinementTestKey1"];
+    XCTAssertNotNil(confinement, @"Expecting the Core confined");
+    XCTAssertTrue(confinement.isOwnerThread, @"Expecting the Core confined to this thread");
+    
+    [facade registerProxy:[Proxy withName:@"ConfinedProxy"]];
+    [facade registerMediator:[Mediator withName:@"ConfinedMediator" component:self]];
+    [facade registerCommand:@"ConfinementTest" factory:^() { return [ControllerTestCommand command]; }];
+    ControllerTestVO *vo = [[ControllerTestVO alloc] initWithInput:12];
+    [facade sendNotification:@"ConfinementTest" body:vo];
+    
+    XCTAssertNotNil([facade retrieveProxy:@"ConfinedProxy"], @"Expecting the proxy registered");
+    XCTAssertTrue([facade hasMediator:@"ConfinedMediator"], @"Expecting the mediator registered");
+    XCTAssertEqual(vo.result, 24, @"Expecting the command executed");
+    XCTAssertNotNil([facade removeProxy:@"ConfinedProxy"], @"Expecting the proxy removed");
+    
+    [Facade removeCore:@"ConfinementTestKey1"];
+    XCTAssertNil([Confinement confinementForKey:@"ConfinementTestKey1"], @"Expecting the confinement removed with the Core");
+}
+
+/**
+Tests that a Core created with `withKey:` is not confined.
+*/
+- (void)testSharedCore {
+    [Facade getInstance:@"ConfinementTestKey2" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    XCTAssertNil([Confinement confinementForKey:@"ConfinementTestKey2"], @"Expecting the Core shared");
+    [Facade removeCore:@"ConfinementTestKey2"];
+}
+
+/**
+Tests that a confinement only owns the thread that created it.
+*/
+- (void)testOwnerThread {
+    Confinement *confinement = [Confinement confineCore:@"ConfinementTestKey3"];
+    XCTAssertEqual([Confinement confineCore:@"ConfinementTestKey3"], confinement, @"Expecting the existing confinement");
+    XCTAssertTrue(confinement.isOwnerThread, @"Expecting this thread to own it");
+    
+    __block BOOL owner = YES;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"other thread"];
+    [NSThread detachNewThreadWithBlock:^{
+        owner = confinement.isOwnerThread;
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    
+    XCTAssertFalse(owner, @"Expecting another thread not to own it");
+    [Confinement removeConfinement:@"ConfinementTestKey3"];
+    XCTAssertNil([Confinement confinementForKey:@"ConfinementTestKey3"], @"Expecting the confinement removed");
+}
+
+@end
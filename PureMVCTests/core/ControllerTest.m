@@ -155,4 +155,42 @@ test will fail.
     XCTAssertTrue(vo.result == 24, @"Expecting vo.result == 24");
 }
 
+/**
+Tests that introspect reports the command mappings.
+*/
+- (void)testIntrospect {
+    id<IController> controller = [Controller getInstance:@"ControllerTestKey6" factory:^(NSString *key){ return [Controller withKey:key]; }];
+    [controller registerCommand:@"introspectB" factory:^() { return [ControllerTestCommand command]; }];
+    [controller registerCommand:@"introspectA" factory:^() { return [ControllerTestCommand command]; }];
+    
+    NSDictionary<NSString *, id> *snapshot = [controller introspect];
+    XCTAssertTrue([NSJSONSerialization isValidJSONObject:snapshot], @"Expecting a JSON-compatible snapshot");
+    XCTAssertEqualObjects(snapshot[@"commands"], (@[@"introspectA", @"introspectB"]), @"Expecting the sorted command mappings");
+}
+
+/**
+Tests that removeAllCommands also removes the observers
+the commands registered with the View, so a command
+registered again is executed only once.
+*/
+- (void)testRemoveAllCommandsAndReregister {
+    Controller *controller = (Controller *)[Controller getInstance:@"ControllerTestKey7" factory:^(NSString *key) { return [Controller withKey:key]; }];
+    [controller registerCommand:@"ControllerRemoveAllTest" factory:^() { return [ControllerTestCommand2 command]; }];
+    
+    [controller removeAllCommands];
+    XCTAssertFalse([controller hasCommand:@"ControllerRemoveAllTest"], @"Expecting [controller hasCommand:@\"ControllerRemoveAllTest\"] false");
+    
+    [controller registerCommand:@"ControllerRemoveAllTest" factory:^() { return [ControllerTestCommand2 command]; }];
+    
+    ControllerTestVO *vo = [[ControllerTestVO alloc] initWithInput:12];
+    id<IView> view = [View getInstance:@"ControllerTestKey7" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view notifyObservers:[Notification withName:@"ControllerRemoveAllTest" body:vo]];
+    
+    // ControllerTestCommand2 accumulates, so a second execution would give 48
+    XCTAssertTrue(vo.result == 24, @"Expecting vo.result == 24");
+    
+    [Controller removeController:@"ControllerTestKey7"];
+    [View removeView:@"ControllerTestKey7"];
+}
+
 @end
@@ -0,0 +1,140 @@
+//
+//  FlightRecorderTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import <unistd.h>
+
+@interface FlightRecorderTest : XCTestCase
+
+@end
+
+@implementation FlightRecorderTest
+
+- (void)tearDown {
+    FlightRecorder.enabled = YES;
+}
+
+/**
+Observer doing nothing.
+*/
+- (void)onNotification:(id<INotification>)notification {
+    
+}
+
+/**
+Read what a dump writes.
+
+- parameter dump: writes to the given file descriptor
+- returns: the text written
+*/
+- (NSString *)capture:(void (^)(int fd))dump {
+    int fds[2];
+    XCTAssertEqual(pipe(fds), 0, @"Expecting a pipe");
+    dump(fds[1]);
+    close(fds[1]);
+    NSData *data = [[[NSFileHandle alloc] initWithFileDescriptor:fds[0] closeOnDealloc:YES] readDataToEndOfFile];
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+}
+
+/**
+Tests that the View records each notification it sends.
+*/
+- (void)testRecordsNotifications {
+    View *view = (View *)[View getInstance:@"FlightRecorderTestKey1" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"Recorded" observer:[Observer withNotify:@selector(onNotification:) context:self]];
+    [view registerObserver:@"Recorded" observer:[Observer withNotify:@selector(onNotification:) context:self]];
+    
+    [view notifyObservers:[Notification withName:@"Recorded" body:nil type:@"First"]];
+    [view notifyObservers:[Notification withName:@"Unobserved"]];
+    
+    NSArray<NSDictionary<NSString *, id> *> *records = view.flightRecorder.records;
+    XCTAssertTrue(FlightRecorder.isEnabled, @"Expecting the recorder enabled by default");
+    XCTAssertEqualObjects(view.flightRecorder.multitonKey, @"FlightRecorderTestKey1", @"Expecting the Core's key");
+    XCTAssertEqual(records.count, (NSUInteger)2, @"Expecting 2 records");
+    XCTAssertEqualObjects(records[0][@"name"], @"Recorded", @"Expecting the oldest record first");
+    XCTAssertEqualObjects(records[0][@"type"], @"First", @"Expecting the type recorded");
+    XCTAssertEqualObjects(records[0][@"fanout"], @2, @"Expecting fanout 2");
+    XCTAssertEqualObjects(records[1][@"name"], @"Unobserved", @"Expecting the newest record last");
+    XCTAssertNil(records[1][@"type"], @"Expecting no type");
+    XCTAssertLessThanOrEqual([records[0][@"timestamp"] unsignedLongLongValue], [records[1][@"timestamp"] unsignedLongLongValue], @"Expecting records in order");
+    
+    [View removeView:@"FlightRecorderTestKey1"];
+}
+
+/**
+Tests that the ring keeps only the most recent records.
+*/
+- (void)testOverwritesOldest {
+    FlightRecorder *recorder = [FlightRecorder withKey:@"FlightRecorderTestKey2" capacity:3];
+    for (int i = 0; i < 10; i++) {
+        [recorder recordNotification:[Notification withName:[NSString stringWithFormat:@"Note%d", i]] start:(uint64_t)i duration:1 fanout:0];
+    }
+    
+    NSArray<NSDictionary<NSString *, id> *> *records = recorder.records;
+    XCTAssertEqual(recorder.capacity, (NSUInteger)4, @"Expecting the capacity rounded up to 4");
+    XCTAssertEqual(recorder.recordedCount, 10ULL, @"Expecting 10 recorded");
+    XCTAssertEqual(records.count, (NSUInteger)4, @"Expecting 4 kept");
+    XCTAssertEqualObjects(records.firstObject[@"name"], @"Note6", @"Expecting the oldest kept first");
+    XCTAssertEqualObjects(records.lastObject[@"name"], @"Note9", @"Expecting the newest last");
+}
+
+/**
+Tests that long names are truncated rather than dropped.
+*/
+- (void)testTruncatesNames {
+    FlightRecorder *recorder = [FlightRecorder withKey:@"FlightRecorderTestKey3" capacity:4];
+    NSString *name = [@"" stringByPaddingToLength:200 withString:@"N" startingAtIndex:0];
+    [recorder recordNotification:[Notification withName:name] start:0 duration:0 fanout:0];
+    
+    NSString *recorded = recorder.records.firstObject[@"name"];
+    XCTAssertEqual(recorded.length, (NSUInteger)63, @"Expecting the name truncated to 63 bytes");
+    XCTAssertTrue([name hasPrefix:recorded], @"Expecting the start of the name kept");
+}
+
+/**
+Tests dumping one recorder and every live recorder to a file descriptor.
+*/
+- (void)testDump {
+    FlightRecorder *recorder = [FlightRecorder withKey:@"FlightRecorderTestKey4" capacity:4];
+    [recorder recordNotification:[Notification withName:@"Dumped" body:nil type:@"Type"] start:5 duration:7 fanout:3];
+    
+    NSString *dump = [self capture:^(int fd) { [recorder dumpToFileDescriptor:fd]; }];
+    XCTAssertEqualObjects(dump, @"core=FlightRecorderTestKey4 seq=0 timestamp=5 duration=7 fanout=3 name=Dumped type=Type\n", @"Expecting one line");
+    
+    NSString *all = [self capture:^(int fd) { FlightRecorderDumpAll(fd); }];
+    XCTAssertTrue([all containsString:@"core=FlightRecorderTestKey4 "], @"Expecting the live recorder dumped");
+}
+
+/**
+Tests that a released recorder is no longer dumped and its ring is reused empty.
+*/
+- (void)testRecycle {
+    @autoreleasepool {
+        FlightRecorder *recorder = [FlightRecorder withKey:@"FlightRecorderTestKey5" capacity:8];
+        [recorder recordNotification:[Notification withName:@"Released"] start:0 duration:0 fanout:0];
+    }
+    XCTAssertFalse([[self capture:^(int fd) { FlightRecorderDumpAll(fd); }] containsString:@"FlightRecorderTestKey5"], @"Expecting the released recorder not dumped");
+    
+    FlightRecorder *recorder = [FlightRecorder withKey:@"FlightRecorderTestKey6" capacity:8];
+    XCTAssertEqual(recorder.records.count, (NSUInteger)0, @"Expecting a reused ring to be empty");
+}
+
+/**
+Tests that nothing is recorded while disabled.
+*/
+- (void)testDisabled {
+    View *view = (View *)[View getInstance:@"FlightRecorderTestKey7" factory:^(NSString *key) { return [View withKey:key]; }];
+    FlightRecorder.enabled = NO;
+    [view notifyObservers:[Notification withName:@"Unrecorded"]];
+    XCTAssertEqual(view.flightRecorder.recordedCount, 0ULL, @"Expecting nothing recorded");
+    
+    [View removeView:@"FlightRecorderTestKey7"];
+}
+
+@end
@@ -0,0 +1,97 @@
+//
+//  InstrumentationTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import "ControllerTestCommand.h"
+#import "ControllerTestVO.h"
+
+@interface InstrumentationTest : XCTestCase
+
+@end
+
+@implementation InstrumentationTest
+
+- (void)setUp {
+    Instrumentation.enabled = YES;
+}
+
+- (void)tearDown {
+    Instrumentation.enabled = NO;
+}
+
+/**
+Observer doing nothing.
+*/
+- (void)onNotification:(id<INotification>)notification {
+    
+}
+
+/**
+Tests that sends, fanout and observers are recorded per name and context class.
+*/
+- (void)testNotifyObservers {
+    View *view = (View *)[View getInstance:@"InstrumentationTestKey1" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"Instrumented" observer:[Observer withNotify:@selector(onNotification:) context:self]];
+    [view registerObserver:@"Instrumented" observer:[Observer withNotify:@selector(onNotification:) context:self]];
+    
+    for (int i = 0; i < 3; i++) {
+        [view notifyObservers:[Notification withName:@"Instrumented"]];
+    }
+    [view notifyObservers:[Notification withName:@"Unobserved"]];
+    
+    XCTAssertEqual(view.instrumentation.notificationLatencies[@"Instrumented"].count, 3ULL, @"Expecting 3 sends");
+    XCTAssertEqual(view.instrumentation.notificationFanouts[@"Instrumented"].sum, 6ULL, @"Expecting 6 observers notified");
+    XCTAssertEqual(view.instrumentation.notificationFanouts[@"Instrumented"].max, 2ULL, @"Expecting fanout 2");
+    XCTAssertEqual(view.instrumentation.notificationFanouts[@"Unobserved"].max, 0ULL, @"Expecting fanout 0");
+    XCTAssertEqual(view.instrumentation.observerLatencies[@"InstrumentationTest"].count, 6ULL, @"Expecting 6 observer notifications");
+    
+    [View removeView:@"InstrumentationTestKey1"];
+}
+
+/**
+Tests that commands are recorded per notification name.
+*/
+- (void)testExecuteCommand {
+    id<IController> controller = [Controller getInstance:@"InstrumentationTestKey2" factory:^(NSString *key) { return [Controller withKey:key]; }];
+    View *view = (View *)[View getInstance:@"InstrumentationTestKey2" factory:^(NSString *key) { return [View withKey:key]; }];
+    [controller registerCommand:@"InstrumentedCommand" factory:^() { return [ControllerTestCommand command]; }];
+    
+    [view notifyObservers:[Notification withName:@"InstrumentedCommand" body:[[ControllerTestVO alloc] initWithInput:12]]];
+    
+    XCTAssertEqual(view.instrumentation.commandLatencies[@"InstrumentedCommand"].count, 1ULL, @"Expecting 1 command execution");
+    XCTAssertEqual(view.instrumentation.observerLatencies[@"Controller"].count, 1ULL, @"Expecting the Controller observed once");
+    
+    [Controller removeController:@"InstrumentationTestKey2"];
+    [View removeView:@"InstrumentationTestKey2"];
+}
+
+/**
+Tests that nothing is recorded while disabled, and that reset clears the histograms.
+*/
+- (void)testDisabledAndReset {
+    View *view = (View *)[View getInstance:@"InstrumentationTestKey3" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"Instrumented" observer:[Observer withNotify:@selector(onNotification:) context:self]];
+    
+    Instrumentation.enabled = NO;
+    [view notifyObservers:[Notification withName:@"Instrumented"]];
+    XCTAssertFalse(Instrumentation.isEnabled, @"Expecting instrumentation disabled");
+    XCTAssertEqual(view.instrumentation.notificationLatencies.count, (NSUInteger)0, @"Expecting nothing recorded");
+    
+    Instrumentation.enabled = YES;
+    [view notifyObservers:[Notification withName:@"Instrumented"]];
+    XCTAssertEqual(view.instrumentation.notificationLatencies[@"Instrumented"].count, 1ULL, @"Expecting 1 send");
+    
+    [view.instrumentation reset];
+    XCTAssertEqual(view.instrumentation.notificationLatencies[@"Instrumented"].count, 0ULL, @"Expecting the histogram reset");
+    XCTAssertEqual(view.instrumentation.observerLatencies[@"InstrumentationTest"].count, 0ULL, @"Expecting the histogram reset");
+    
+    [View removeView:@"InstrumentationTestKey3"];
+}
+
+@end
@@ -0,0 +1,132 @@
+//
+//  LatencyHistogramTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+
+@interface LatencyHistogramTest : XCTestCase
+
+@end
+
+@implementation LatencyHistogramTest
+
+/**
+Tests that an empty histogram reports zeros.
+*/
+- (void)testEmpty {
+    LatencyHistogram *histogram = [LatencyHistogram histogram];
+    
+    XCTAssertEqual(histogram.count, 0ULL, @"Expecting no values");
+    XCTAssertEqual(histogram.min, 0ULL, @"Expecting min 0");
+    XCTAssertEqual(histogram.max, 0ULL, @"Expecting max 0");
+    XCTAssertEqual(histogram.mean, 0.0, @"Expecting mean 0");
+    XCTAssertEqual([histogram valueAtPercentile:50], 0ULL, @"Expecting p50 0");
+}
+
+/**
+Tests count, sum, min, max and mean of recorded values.
+*/
+- (void)testRecordValue {
+    LatencyHistogram *histogram = [LatencyHistogram histogram];
+    [histogram recordValue:10];
+    [histogram recordValue:20];
+    [histogram recordValue:30];
+    
+    XCTAssertEqual(histogram.count, 3ULL, @"Expecting 3 values");
+    XCTAssertEqual(histogram.sum, 60ULL, @"Expecting sum 60");
+    XCTAssertEqual(histogram.min, 10ULL, @"Expecting min 10");
+    XCTAssertEqual(histogram.max, 30ULL, @"Expecting max 30");
+    XCTAssertEqual(histogram.mean, 20.0, @"Expecting mean 20");
+}
+
+/**
+Tests that percentiles are reported within the bucket resolution.
+*/
+- (void)testValueAtPercentile {
+    LatencyHistogram *histogram = [LatencyHistogram histogram];
+    for (uint64_t value = 1; value <= 100000; value++) {
+        [histogram recordValue:value * 1000];
+    }
+    
+    uint64_t p50 = [histogram valueAtPercentile:50];
+    uint64_t p99 = [histogram valueAtPercentile:99];
+    XCTAssertEqualWithAccuracy((double)p50, 50000000.0, 50000000.0 * 0.04, @"Expecting p50 within 4%%");
+    XCTAssertEqualWithAccuracy((double)p99, 99000000.0, 99000000.0 * 0.04, @"Expecting p99 within 4%%");
+    XCTAssertEqual([histogram valueAtPercentile:100], 100000000ULL, @"Expecting p100 to be the max");
+    XCTAssertLessThanOrEqual([histogram valueAtPercentile:0], 1040ULL, @"Expecting p0 within 4%% of the min");
+}
+
+/**
+Tests that small values are counted exactly and huge values are kept.
+*/
+- (void)testRange {
+    LatencyHistogram *histogram = [LatencyHistogram histogram];
+    [histogram recordValue:0];
+    [histogram recordValue:7];
+    [histogram recordValue:UINT64_MAX];
+    
+    XCTAssertEqual([histogram valueAtPercentile:33], 0ULL, @"Expecting 0 counted exactly");
+    XCTAssertEqual([histogram valueAtPercentile:66], 7ULL, @"Expecting 7 counted exactly");
+    XCTAssertEqual(histogram.max, UINT64_MAX, @"Expecting the max kept");
+    XCTAssertEqual(histogram.count, 3ULL, @"Expecting 3 values");
+}
+
+/**
+Tests that a snapshot is unaffected by later records and resets.
+*/
+- (void)testSnapshotAndReset {
+    LatencyHistogram *histogram = [LatencyHistogram histogram];
+    [histogram recordValue:100];
+    LatencyHistogram *snapshot = [histogram snapshot];
+    [histogram recordValue:200];
+    [histogram reset];
+    
+    XCTAssertEqual(snapshot.count, 1ULL, @"Expecting the snapshot to keep 1 value");
+    XCTAssertEqual(snapshot.max, 100ULL, @"Expecting the snapshot max 100");
+    XCTAssertEqual(histogram.count, 0ULL, @"Expecting the histogram to be reset");
+    XCTAssertEqual(histogram.min, 0ULL, @"Expecting the min to be reset");
+    XCTAssertEqual(histogram.max, 0ULL, @"Expecting the max to be reset");
+}
+
+/**
+Tests that adding a histogram merges its counts, min and max.
+*/
+- (void)testAddHistogram {
+    LatencyHistogram *histogram = [LatencyHistogram histogram];
+    [histogram recordValue:100];
+    LatencyHistogram *other = [LatencyHistogram histogram];
+    [other recordValue:10];
+    [other recordValue:1000];
+    [histogram addHistogram:other];
+    [histogram addHistogram:[LatencyHistogram histogram]];
+
+    XCTAssertEqual(histogram.count, 3ULL, @"Expecting 3 values");
+    XCTAssertEqual(histogram.sum, 1110ULL, @"Expecting the sums added");
+    XCTAssertEqual(histogram.min, 10ULL, @"Expecting min 10");
+    XCTAssertEqual(histogram.max, 1000ULL, @"Expecting max 1000");
+    XCTAssertEqual([histogram valueAtPercentile:100], 1000ULL, @"Expecting p100 at max");
+}
+
+/**
+Tests that concurrent records are not lost.
+*/
+- (void)testConcurrentRecord {
+    LatencyHistogram *histogram = [LatencyHistogram histogram];
+    dispatch_apply(8, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        for (uint64_t value = 1; value <= 10000; value++) {
+            [histogram recordValue:value];
+        }
+    });
+    
+    XCTAssertEqual(histogram.count, 80000ULL, @"Expecting every value counted");
+    XCTAssertEqual(histogram.sum, 8ULL * 10000 * 10001 / 2, @"Expecting every value summed");
+    XCTAssertEqual(histogram.min, 1ULL, @"Expecting min 1");
+    XCTAssertEqual(histogram.max, 10000ULL, @"Expecting max 10000");
+}
+
+@end
@@ -0,0 +1,76 @@
+//
+//  MapLockTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+
+@interface MapLockTest : XCTestCase
+
+@end
+
+@implementation MapLockTest
+
+/**
+Tests that every shared strategy keeps writes exclusive of reads and of one another.
+*/
+- (void)testStrategies {
+    MapLockStrategy strategies[] = { MapLockStrategyDispatch, MapLockStrategyReadWrite, MapLockStrategySpin, MapLockStrategyReadMostly };
+    for (size_t s = 0; s < sizeof(strategies) / sizeof(strategies[0]); s++) {
+        id<IMapLock> lock = [MapLock lockWithStrategy:strategies[s] label:@"MapLockTest"];
+        NSMutableDictionary<NSString *, NSNumber *> *map = [NSMutableDictionary dictionaryWithDictionary:@{@"a": @0, @"b": @0}];
+        __block BOOL consistent = YES;
+        
+        dispatch_apply(8, DISPATCH_APPLY_AUTO, ^(size_t i) {
+            for (int n = 0; n < 2000; n++) {
+                if (n % 4 == 0) {
+                    [lock write:^{
+                        map[@"a"] = @(map[@"a"].intValue + 1);
+                        map[@"b"] = @(map[@"b"].intValue + 1);
+                    }];
+                } else {
+                    [lock read:^{
+                        if (![map[@"a"] isEqualToNumber:map[@"b"]]) consistent = NO;
+                    }];
+                }
+            }
+        });
+        
+        XCTAssertTrue(consistent, @"Expecting reads never to see half a write with strategy %ld", (long)strategies[s]);
+        XCTAssertEqual(map[@"a"].intValue, 8 * 500, @"Expecting no write lost with strategy %ld", (long)strategies[s]);
+    }
+}
+
+/**
+Tests that a Core created with a strategy keeps it until it is removed.
+*/
+- (void)testCoreStrategy {
+    id<IFacade> facade = [Facade getInstance:@"MapLockTestKey1" factory:^(NSString *key) { return [Facade withKey:key mapLockStrategy:MapLockStrategyReadWrite]; }];
+    XCTAssertEqual([MapLock strategyForCore:@"MapLockTestKey1"], MapLockStrategyReadWrite, @"Expecting the chosen strategy");
+    
+    [facade registerProxy:[Proxy withName:@"MapLockProxy"]];
+    [facade registerMediator:[Mediator withName:@"MapLockMediator" component:self]];
+    XCTAssertNotNil([facade retrieveProxy:@"MapLockProxy"], @"Expecting the proxy registered");
+    XCTAssertTrue([facade hasMediator:@"MapLockMediator"], @"Expecting the mediator registered");
+    
+    [Facade removeCore:@"MapLockTestKey1"];
+    XCTAssertEqual([MapLock strategyForCore:@"MapLockTestKey1"], MapLockStrategyDispatch, @"Expecting the default strategy once removed");
+}
+
+/**
+Tests that a confined Core reports the confined strategy.
+*/
+- (void)testConfinedStrategy {
+    [Facade getInstance:@"MapLockTestKey2" factory:^(NSString *key) { return [Facade confinedWithKey:key]; }];
+    XCTAssertEqual([MapLock strategyForCore:@"MapLockTestKey2"], MapLockStrategyConfined, @"Expecting the confined strategy");
+    XCTAssertNotNil([Confinement confinementForKey:@"MapLockTestKey2"], @"Expecting the Core confined");
+    
+    [Facade removeCore:@"MapLockTestKey2"];
+    XCTAssertNil([Confinement confinementForKey:@"MapLockTestKey2"], @"Expecting the confinement removed");
+}
+
+@end
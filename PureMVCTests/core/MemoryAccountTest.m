@@ -0,0 +1,99 @@
+//
+//  MemoryAccountTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import "ViewTestMediator2.h"
+#import "ModelTestFootprintProxy.h"
+
+@interface MemoryAccountTest : XCTestCase
+
+@end
+
+@implementation MemoryAccountTest
+
+- (void)setUp {
+    MemoryAccount.enabled = YES;
+}
+
+- (void)tearDown {
+    MemoryAccount.enabled = NO;
+}
+
+/**
+Tests that a Core's registrations, notifications and commands are
+attributed to its account, and that removals release live bytes.
+*/
+- (void)testAccountsCoreMemory {
+    id<IFacade> facade = [Facade getInstance:@"MemoryAccountTestKey1" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    MemoryAccount *account = [MemoryAccount accountForKey:@"MemoryAccountTestKey1"];
+    View *view = (View *)[View getInstance:@"MemoryAccountTestKey1" factory:^(NSString *key) { return [View withKey:key]; }];
+    XCTAssertNotNil(account, @"Expecting the Core to have an account");
+    XCTAssertEqual(view.memoryAccount, account, @"Expecting the View to share the Core's account");
+    
+    [facade registerMediator:[ViewTestMediator2 withComponent:self]];
+    [facade registerProxy:[ModelTestFootprintProxy withName:@"footprint" data:[NSMutableData dataWithLength:4096]]];
+    [facade registerCommand:@"MemoryAccountTest" factory:^id<ICommand> { return [SimpleCommand command]; }];
+    
+    XCTAssertGreaterThan([account liveBytesInCategory:MemoryCategoryObserver], 0, @"Expecting live observers");
+    XCTAssertGreaterThan([account liveBytesInCategory:MemoryCategoryObserverList], 0, @"Expecting live observer lists");
+    XCTAssertEqual([account liveBytesInCategory:MemoryCategoryMap], (int64_t)(3 * MemoryAccountEntrySize), @"Expecting 3 map entries");
+    XCTAssertEqual(account.payloadBytes, 4096U, @"Expecting the proxy's footprint as payload");
+    
+    [facade sendNotification:@"MemoryAccountTest"];
+    XCTAssertEqual([account allocationsInCategory:MemoryCategoryNotification], 1ULL, @"Expecting 1 notification");
+    XCTAssertEqual([account allocationsInCategory:MemoryCategoryCommand], 1ULL, @"Expecting 1 command");
+    XCTAssertEqual([account liveBytesInCategory:MemoryCategoryCommand], 0, @"Expecting commands not to stay live");
+    XCTAssertTrue([NSJSONSerialization isValidJSONObject:[account report]], @"Expecting a JSON-compatible report");
+    
+    [facade removeMediator:ViewTestMediator2.NAME];
+    [facade removeProxy:@"footprint"];
+    [facade removeCommand:@"MemoryAccountTest"];
+    XCTAssertEqual(account.liveBytes, 0, @"Expecting every registration released");
+    XCTAssertEqual(account.payloadBytes, 0U, @"Expecting no payload");
+    
+    [Facade removeCore:@"MemoryAccountTestKey1"];
+    XCTAssertNil([MemoryAccount accountForKey:@"MemoryAccountTestKey1"], @"Expecting the account removed with the Core");
+}
+
+/**
+Tests that nothing is recorded while accounting is off.
+*/
+- (void)testDisabled {
+    MemoryAccount.enabled = NO;
+    id<IFacade> facade = [Facade getInstance:@"MemoryAccountTestKey2" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    [facade registerMediator:[ViewTestMediator2 withComponent:self]];
+    [facade sendNotification:@"MemoryAccountTest"];
+    
+    XCTAssertFalse(MemoryAccount.isEnabled, @"Expecting accounting off");
+    XCTAssertNil([MemoryAccount accountForKey:@"MemoryAccountTestKey2"], @"Expecting no account created");
+    [Facade removeCore:@"MemoryAccountTestKey2"];
+}
+
+/**
+Tests that removing every mediator and command releases the observers
+they were accounted for.
+*/
+- (void)testRemoveAllReleasesObservers {
+    id<IFacade> facade = [Facade getInstance:@"MemoryAccountTestKey3" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    MemoryAccount *account = [MemoryAccount accountForKey:@"MemoryAccountTestKey3"];
+    [facade registerMediator:[ViewTestMediator2 withComponent:self]];
+    [facade registerCommand:@"MemoryAccountTest" factory:^id<ICommand> { return [SimpleCommand command]; }];
+    XCTAssertGreaterThan([account liveBytesInCategory:MemoryCategoryObserver], 0, @"Expecting live observers");
+    
+    View *view = (View *)[View getInstance:@"MemoryAccountTestKey3" factory:^(NSString *key) { return [View withKey:key]; }];
+    Controller *controller = (Controller *)[Controller getInstance:@"MemoryAccountTestKey3" factory:^(NSString *key) { return [Controller withKey:key]; }];
+    [view removeAllMediators];
+    [controller removeAllCommands];
+    XCTAssertEqual([account liveBytesInCategory:MemoryCategoryObserver], 0, @"Expecting every observer released");
+    XCTAssertEqual(account.liveBytes, 0, @"Expecting every registration released");
+    
+    [Facade removeCore:@"MemoryAccountTestKey3"];
+}
+
+@end
@@ -9,6 +9,9 @@
 #import <XCTest/XCTest.h>
 #import <PureMVC/PureMVC.h>
 #import "ModelTestProxy.h"
+#import "ModelTestFootprintProxy.h"
+#import "ModelTestSnapshotProxy.h"
+#import "ModelTestAsyncProxy.h"
 
 @interface ModelTest : XCTestCase
 
@@ -118,4 +121,289 @@ Tests that the Model calls the onRegister and onRemove methods
 
 }
 
+/**
+Tests that a Proxy registered by factory is created lazily
+and has onRegister called on its first retrieval.
+*/
+- (void)testRegisterProxyFactory {
+    // Register a factory, counting how many times it is invoked
+    id<IModel> model = [Model getInstance:@"ModelTestKey6" factory:^(NSString *key){ return [Model withKey:key]; }];
+    __block NSInteger created = 0;
+    [model registerProxyFactory:^() { created++; return [ModelTestProxy proxy]; } name:[ModelTestProxy NAME]];
+    
+    // Assert the factory has not been invoked, but the Proxy is reported as registered
+    XCTAssertEqual(created, 0, @"Expecting created == 0");
+    XCTAssertTrue([model hasProxy:[ModelTestProxy NAME]], @"Expecting [model hasProxy:ModelTestProxy.NAME]");
+    
+    // Retrieve the Proxy twice
+    id<IProxy> proxy = [model retrieveProxy:[ModelTestProxy NAME]];
+    id<IProxy> proxy2 = [model retrieveProxy:[ModelTestProxy NAME]];
+    
+    // Assert the factory was invoked once and onRegister was called
+    XCTAssertEqual(created, 1, @"Expecting created == 1");
+    XCTAssertEqual(proxy, proxy2, @"Expecting proxy == proxy2");
+    XCTAssertEqualObjects(proxy.data, [ModelTestProxy ON_REGISTER_CALLED], @"Expecting proxy.data == [ModelTestProxy ON_REGISTER_CALLED]");
+    
+    // Remove the Proxy, which also removes its factory
+    [model removeProxy:[ModelTestProxy NAME]];
+    
+    // Assert onRemove was called and the Proxy is no longer retrievable
+    XCTAssertEqualObjects(proxy.data, [ModelTestProxy ON_REMOVE_CALLED], @"Expecting proxy.data == [ModelTestProxy ON_REMOVE_CALLED]");
+    XCTAssertFalse([model hasProxy:[ModelTestProxy NAME]], @"Expecting [model hasProxy:ModelTestProxy.NAME] == false");
+    XCTAssertNil([model retrieveProxy:[ModelTestProxy NAME]], @"Expecting [model retrieveProxy:ModelTestProxy.NAME] == nil");
+}
+
+/**
+Tests that concurrent first retrievals of a factory registered
+Proxy create only one instance.
+*/
+- (void)testRegisterProxyFactoryConcurrently {
+    id<IModel> model = [Model getInstance:@"ModelTestKey7" factory:^(NSString *key){ return [Model withKey:key]; }];
+    __block int32_t created = 0;
+    [model registerProxyFactory:^() {
+        __atomic_fetch_add(&created, 1, __ATOMIC_SEQ_CST);
+        return [Proxy withName:@"lazy" data:@[@"value"]];
+    } name:@"lazy"];
+    
+    // Retrieve from many threads at once
+    NSMutableArray *proxies = [NSMutableArray array];
+    dispatch_apply(64, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t index) {
+        id<IProxy> proxy = [model retrieveProxy:@"lazy"];
+        @synchronized (proxies) {
+            [proxies addObject:proxy];
+        }
+    });
+    
+    // Assert a single instance was created and returned to every thread
+    XCTAssertEqual(created, 1, @"Expecting created == 1");
+    XCTAssertEqual([[NSSet setWithArray:proxies] count], 1, @"Expecting a single Proxy instance");
+}
+
+/**
+Tests that the least recently retrieved Proxy is evicted
+when the memory budget is exceeded, and recreated from its
+factory on its next retrieval.
+*/
+- (void)testMemoryBudgetEviction {
+    Model *model = (Model *)[Model getInstance:@"ModelTestKey8" factory:^(NSString *key){ return [Model withKey:key]; }];
+    model.memoryBudget = 250;
+    
+    // Register three 100 byte Proxy factories
+    for (NSString *name in @[@"a", @"b", @"c"]) {
+        [model registerProxyFactory:^() {
+            return [ModelTestFootprintProxy withName:name data:[NSMutableData dataWithLength:100]];
+        } name:name];
+    }
+    
+    // Retrieve a and b, then a again so b is the least recently retrieved
+    ModelTestFootprintProxy *a = (ModelTestFootprintProxy *)[model retrieveProxy:@"a"];
+    ModelTestFootprintProxy *b = (ModelTestFootprintProxy *)[model retrieveProxy:@"b"];
+    [model retrieveProxy:@"a"];
+    
+    // Retrieving c exceeds the budget and evicts b
+    [model retrieveProxy:@"c"];
+    XCTAssertTrue(b.onRemoveCalled, @"Expecting b.onRemoveCalled");
+    XCTAssertFalse(a.onRemoveCalled, @"Expecting a.onRemoveCalled == false");
+    
+    // Evicted proxies are still registered, and are recreated on retrieval
+    XCTAssertTrue([model hasProxy:@"b"], @"Expecting [model hasProxy:@'b']");
+    ModelTestFootprintProxy *b2 = (ModelTestFootprintProxy *)[model retrieveProxy:@"b"];
+    XCTAssertNotNil(b2, @"Expecting b2 not nil");
+    XCTAssertNotEqual(b, b2, @"Expecting b2 to be a new instance");
+    
+    // Assert the statistics
+    XCTAssertEqual(model.cacheHits, 1, @"Expecting model.cacheHits == 1");
+    XCTAssertEqual(model.cacheMisses, 4, @"Expecting model.cacheMisses == 4");
+    XCTAssertEqual(model.cacheEvictions, 2, @"Expecting model.cacheEvictions == 2");
+    
+    [model resetCacheStatistics];
+    XCTAssertEqual(model.cacheEvictions, 0, @"Expecting model.cacheEvictions == 0");
+}
+
+/**
+Tests that proxies registered without a factory are never evicted.
+*/
+- (void)testMemoryBudgetKeepsProxiesWithoutFactory {
+    Model *model = (Model *)[Model getInstance:@"ModelTestKey9" factory:^(NSString *key){ return [Model withKey:key]; }];
+    ModelTestFootprintProxy *proxy = [ModelTestFootprintProxy withName:@"eager" data:[NSMutableData dataWithLength:100]];
+    [model registerProxy:proxy];
+    [model registerProxy:[ModelTestFootprintProxy withName:@"eager2" data:[NSMutableData dataWithLength:100]]];
+    
+    // Shrinking the budget cannot evict anything
+    model.memoryBudget = 10;
+    
+    XCTAssertFalse(proxy.onRemoveCalled, @"Expecting proxy.onRemoveCalled == false");
+    XCTAssertEqual([model retrieveProxy:@"eager"], proxy, @"Expecting the same Proxy instance");
+    XCTAssertEqual(model.cacheEvictions, 0, @"Expecting model.cacheEvictions == 0");
+}
+
+/**
+Tests writing a snapshot from one Model and restoring it into another.
+*/
+- (void)testWriteAndLoadSnapshot {
+    NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:@"ModelTestSnapshot1.pmvs"]];
+    
+    // Register the Proxy, which parses its data in onRegister, and write a snapshot
+    id<IModel> model = [Model getInstance:@"ModelTestKey10" factory:^(NSString *key){ return [Model withKey:key]; }];
+    ModelTestSnapshotProxy *proxy = [ModelTestSnapshotProxy proxy];
+    [model registerProxy:proxy];
+    [model registerProxy:[Proxy withName:@"plain" data:@"not snapshotted"]];
+    NSError *error = nil;
+    XCTAssertTrue([(Model *)model writeSnapshotToURL:url error:&error], @"Expecting snapshot written, error: %@", error);
+    XCTAssertFalse(proxy.restored, @"Expecting proxy.restored == false");
+    
+    // Load the snapshot into a second Model and register the Proxy lazily
+    id<IModel> model2 = [Model getInstance:@"ModelTestKey11" factory:^(NSString *key){ return [Model withKey:key]; }];
+    XCTAssertTrue([(Model *)model2 loadSnapshotFromURL:url error:&error], @"Expecting snapshot loaded, error: %@", error);
+    [model2 registerProxyFactory:^() { return [ModelTestSnapshotProxy proxy]; } name:[ModelTestSnapshotProxy NAME]];
+    ModelTestSnapshotProxy *restored = (ModelTestSnapshotProxy *)[model2 retrieveProxy:[ModelTestSnapshotProxy NAME]];
+    
+    // Assert the data was restored rather than parsed
+    XCTAssertTrue(restored.restored, @"Expecting restored.restored == true");
+    XCTAssertEqualObjects(restored.data, proxy.data, @"Expecting restored.data == proxy.data");
+    
+    [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+}
+
+/**
+Tests that a truncated or foreign file is rejected.
+*/
+- (void)testLoadInvalidSnapshot {
+    NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:@"ModelTestSnapshot2.pmvs"]];
+    [[@"not a snapshot" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:url atomically:YES];
+    
+    id<IModel> model = [Model getInstance:@"ModelTestKey12" factory:^(NSString *key){ return [Model withKey:key]; }];
+    NSError *error = nil;
+    XCTAssertFalse([(Model *)model loadSnapshotFromURL:url error:&error], @"Expecting snapshot rejected");
+    XCTAssertNotNil(error, @"Expecting error not nil");
+    
+    [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+}
+
+/**
+Tests that a Proxy handle tracks registration, lazy creation and removal.
+*/
+- (void)testRetrieveProxyHandle {
+    id<IModel> model = [Model getInstance:@"ModelTestKey14" factory:^(NSString *key){ return [Model withKey:key]; }];
+    id<IProxy> proxy = [Proxy withName:@"handled" data:@"first"];
+    [model registerProxy:proxy];
+    
+    // Resolve the handle once, and read through it
+    id<IHandle> handle = [model retrieveProxyHandle:@"handled"];
+    XCTAssertEqual(handle.target, proxy, @"Expecting handle.target == proxy");
+    XCTAssertEqual([model retrieveProxyHandle:@"handled"], handle, @"Expecting the same handle instance");
+    
+    // Remove the Proxy, the handle sees nil
+    [model removeProxy:@"handled"];
+    XCTAssertNil(handle.target, @"Expecting handle.target == nil");
+    
+    // Register a factory, the handle creates the Proxy on access
+    [model registerProxyFactory:^() { return [Proxy withName:@"handled" data:@"second"]; } name:@"handled"];
+    id<IProxy> proxy2 = handle.target;
+    XCTAssertNotNil(proxy2, @"Expecting handle.target not nil");
+    XCTAssertEqualObjects(proxy2.data, @"second", @"Expecting handle.target.data == 'second'");
+    XCTAssertEqual([model retrieveProxy:@"handled"], proxy2, @"Expecting handle.target == [model retrieveProxy:@'handled']");
+}
+
+/**
+Tests that async proxies load concurrently after registration returns.
+*/
+- (void)testAsyncProxyLoading {
+    Model *model = (Model *)[Model getInstance:@"ModelTestKey15" factory:^(NSString *key){ return [Model withKey:key]; }];
+    NSArray<NSString *> *names = @[@"async1", @"async2", @"async3"];
+    
+    // Register three proxies whose loads finish only once all three, and this test, have arrived
+    dispatch_group_t rendezvous = dispatch_group_create();
+    dispatch_group_enter(rendezvous);
+    NSMutableArray<ModelTestAsyncProxy *> *proxies = [NSMutableArray array];
+    for (NSString *name in names) {
+        ModelTestAsyncProxy *proxy = [ModelTestAsyncProxy withName:name];
+        dispatch_group_enter(rendezvous);
+        proxy.rendezvous = rendezvous;
+        [proxies addObject:proxy];
+        [model registerProxy:proxy];
+    }
+    
+    // Assert registration did not wait for the loads
+    XCTAssertEqual([model proxyReadiness:@"async1"], ProxyReadinessLoading, @"Expecting async1 to be loading");
+    XCTAssertNil([model retrieveProxy:@"async1"].data, @"Expecting async1.data == nil");
+    dispatch_group_leave(rendezvous);
+    
+    // Wait for all of them, and assert the loads overlapped
+    XCTestExpectation *expectation = [self expectationWithDescription:@"awaitProxies"];
+    [model awaitProxies:names completion:^{
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30 handler:nil];
+    for (ModelTestAsyncProxy *proxy in proxies) {
+        XCTAssertTrue(proxy.overlapped, @"Expecting %@ loaded while the others were in flight", proxy.name);
+    }
+    for (NSString *name in names) {
+        XCTAssertEqual([model proxyReadiness:name], ProxyReadinessReady, @"Expecting %@ to be ready", name);
+        XCTAssertEqualObjects([model retrieveProxy:name].data, [ModelTestAsyncProxy LOADED], @"Expecting %@.data == 'loaded'", name);
+    }
+    
+    // Assert the readiness notifications did not create a View for the Core
+    XCTAssertNil([View viewForKey:@"ModelTestKey15"], @"Expecting no View for ModelTestKey15");
+}
+
+/**
+A counter of the PROXY_READY notifications received.
+*/
+static int32_t proxyReadyCount = 0;
+
+/**
+A utility method to count PROXY_READY notifications.
+*/
+- (void)proxyReady:(id<INotification>)notification {
+    __atomic_fetch_add(&proxyReadyCount, 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+Tests the readiness notifications and awaiting a set of proxies.
+*/
+- (void)testAwaitProxiesAndReadyNotification {
+    Model *model = (Model *)[Model getInstance:@"ModelTestKey16" factory:^(NSString *key){ return [Model withKey:key]; }];
+    id<IView> view = [View getInstance:@"ModelTestKey16" factory:^(NSString *key){ return [View withKey:key]; }];
+    [view registerObserver:[Model PROXY_READY] observer:[Observer withNotify:@selector(proxyReady:) context:self]];
+    
+    // Register one Proxy that loads and one that fails, the first lazily
+    [model registerProxyFactory:^() { return [ModelTestAsyncProxy withName:@"loads"]; } name:@"loads"];
+    ModelTestAsyncProxy *failing = [ModelTestAsyncProxy withName:@"fails"];
+    failing.error = [NSError errorWithDomain:@"ModelTest" code:1 userInfo:nil];
+    [model registerProxy:failing];
+    
+    // Await both, which also creates the lazy Proxy
+    XCTestExpectation *expectation = [self expectationWithDescription:@"awaitProxies"];
+    [model awaitProxies:@[@"loads", @"fails"] completion:^{
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    
+    // Assert the readiness of each, and that one PROXY_READY was sent
+    XCTAssertEqual([model proxyReadiness:@"loads"], ProxyReadinessReady, @"Expecting 'loads' to be ready");
+    XCTAssertEqual([model proxyReadiness:@"fails"], ProxyReadinessFailed, @"Expecting 'fails' to have failed");
+    XCTAssertEqual(__atomic_load_n(&proxyReadyCount, __ATOMIC_SEQ_CST), 1, @"Expecting proxyReadyCount == 1");
+}
+
+/**
+Tests that introspect reports proxies and factories not created yet.
+*/
+- (void)testIntrospect {
+    id<IModel> model = [Model getInstance:@"ModelTestKey17" factory:^(NSString *key){ return [Model withKey:key]; }];
+    [model registerProxy:[Proxy withName:@"colors" data:@[@"red", @"green"]]];
+    [model registerProxyFactory:^() { return [ModelTestProxy proxy]; } name:[ModelTestProxy NAME]];
+    
+    NSDictionary<NSString *, id> *snapshot = [model introspect];
+    XCTAssertTrue([NSJSONSerialization isValidJSONObject:snapshot], @"Expecting a JSON-compatible snapshot");
+    XCTAssertEqualObjects(snapshot[@"proxies"], (@[@{@"name": @"colors", @"class": @"Proxy", @"readiness": @"ready"}]), @"Expecting the registered proxy");
+    XCTAssertEqualObjects(snapshot[@"factories"], @[[ModelTestProxy NAME]], @"Expecting the pending factory");
+    
+    // Once created, the factory registered Proxy is reported with the proxies
+    [model retrieveProxy:[ModelTestProxy NAME]];
+    snapshot = [model introspect];
+    XCTAssertEqual([snapshot[@"proxies"] count], 2U, @"Expecting 2 proxies");
+    XCTAssertEqual([snapshot[@"factories"] count], 0U, @"Expecting no pending factories");
+}
+
 @end
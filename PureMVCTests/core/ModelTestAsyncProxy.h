@@ -0,0 +1,32 @@
+//
+//  ModelTestAsyncProxy.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <PureMVC/PureMVC.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ModelTestAsyncProxy : Proxy <IAsyncProxy>
+
++ (NSString *)LOADED;
+
+/// Simulated I/O time of the load, in seconds.
+@property (nonatomic, assign) NSTimeInterval delay;
+
+/// Error to complete the load with, nil to succeed.
+@property (nonatomic, strong, nullable) NSError *error;
+
+/// A group each load leaves on arrival and then waits on, so loads sharing it finish only once all are in flight.
+@property (nonatomic, strong, nullable) dispatch_group_t rendezvous;
+
+/// Whether every load sharing `rendezvous` was in flight at once.
+@property (nonatomic, assign) BOOL overlapped;
+
+@end
+
+NS_ASSUME_NONNULL_END
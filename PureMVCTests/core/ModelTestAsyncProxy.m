@@ -0,0 +1,29 @@
+//
+//  ModelTestAsyncProxy.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import "ModelTestAsyncProxy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation ModelTestAsyncProxy
+
++ (NSString *)LOADED { return @"loaded"; }
+
+- (void)loadWithCompletion:(void (^)(NSError * _Nullable error))completion {
+    if (self.rendezvous != nil) {
+        dispatch_group_leave(self.rendezvous);
+        self.overlapped = dispatch_group_wait(self.rendezvous, dispatch_time(DISPATCH_TIME_NOW, 5 * NSEC_PER_SEC)) == 0;
+    }
+    [NSThread sleepForTimeInterval:self.delay];
+    if (self.error == nil) self.data = [ModelTestAsyncProxy LOADED];
+    completion(self.error);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,20 @@
+//
+//  ModelTestFootprintProxy.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <PureMVC/PureMVC.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ModelTestFootprintProxy : Proxy <IMemoryFootprint>
+
+@property (nonatomic, assign) BOOL onRemoveCalled;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,25 @@
+//
+//  ModelTestFootprintProxy.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import "ModelTestFootprintProxy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation ModelTestFootprintProxy
+
+- (NSUInteger)memoryFootprint {
+    return [(NSData *)self.data length];
+}
+
+- (void)onRemove {
+    self.onRemoveCalled = YES;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,23 @@
+//
+//  ModelTestSnapshotProxy.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <Foundation/Foundation.h>
+#import <PureMVC/PureMVC.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ModelTestSnapshotProxy : Proxy <ISnapshotProxy>
+
++ (NSString *)NAME;
+
+/// Whether the data was restored from a snapshot rather than parsed in `onRegister`.
+@property (nonatomic, assign) BOOL restored;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,52 @@
+//
+//  ModelTestSnapshotProxy.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import "ModelTestSnapshotProxy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation ModelTestSnapshotProxy
+
++ (NSString *)NAME { return @"ModelTestSnapshotProxy"; }
+
+/// A JSON payload of 100,000 integers, standing in for a fetched response.
++ (NSData *)payload {
+    static NSData *payload = nil;
+    static dispatch_once_t once;
+    dispatch_once(&once, ^{
+        NSMutableArray *values = [NSMutableArray arrayWithCapacity:100000];
+        for (int i = 0; i < 100000; i++) [values addObject:@(i)];
+        payload = [NSJSONSerialization dataWithJSONObject:values options:0 error:nil];
+    });
+    return payload;
+}
+
+- (void)onRegister {
+    // restored from a snapshot, nothing to load
+    if (self.data != nil) return;
+    
+    // parse the payload into packed integers
+    NSArray<NSNumber *> *values = [NSJSONSerialization JSONObjectWithData:[ModelTestSnapshotProxy payload] options:0 error:nil];
+    NSMutableData *data = [NSMutableData dataWithLength:values.count * sizeof(int32_t)];
+    int32_t *ints = data.mutableBytes;
+    for (NSUInteger i = 0; i < values.count; i++) ints[i] = [values[i] intValue];
+    self.data = data;
+}
+
+- (nullable NSData *)snapshotData {
+    return self.data;
+}
+
+- (void)restoreSnapshotData:(NSData *)data {
+    self.data = data;
+    self.restored = YES;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
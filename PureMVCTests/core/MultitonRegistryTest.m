@@ -0,0 +1,105 @@
+//
+//  MultitonRegistryTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+
+@interface MultitonRegistryTest : XCTestCase
+
+@end
+
+@implementation MultitonRegistryTest
+
+/**
+Tests registering, looking up and removing instances.
+*/
+- (void)testSetObjectAndRemove {
+    MultitonRegistry<NSString *> *registry = [MultitonRegistry registry];
+    XCTAssertNil([registry objectForKey:@"key"], @"Expecting [registry objectForKey:@'key'] == nil");
+    
+    [registry setObject:@"value" forKey:@"key"];
+    XCTAssertEqualObjects([registry objectForKey:@"key"], @"value", @"Expecting [registry objectForKey:@'key'] == 'value'");
+    
+    XCTAssertEqualObjects([registry removeObjectForKey:@"key"], @"value", @"Expecting removed object == 'value'");
+    XCTAssertNil([registry objectForKey:@"key"], @"Expecting [registry objectForKey:@'key'] == nil");
+    XCTAssertNil([registry removeObjectForKey:@"key"], @"Expecting nothing left to remove");
+}
+
+/**
+Tests that concurrent callers for the same key run the factory once.
+*/
+- (void)testFactoryCalledOncePerKey {
+    MultitonRegistry<NSObject *> *registry = [MultitonRegistry registry];
+    __block int32_t created = 0;
+    NSMutableSet *objects = [NSMutableSet set];
+    
+    dispatch_apply(64, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t index) {
+        NSObject *object = [registry objectForKey:@"key" factory:^(NSString *key) {
+            __atomic_fetch_add(&created, 1, __ATOMIC_SEQ_CST);
+            return [[NSObject alloc] init];
+        }];
+        @synchronized (objects) {
+            [objects addObject:object];
+        }
+    });
+    
+    XCTAssertEqual(created, 1, @"Expecting created == 1");
+    XCTAssertEqual(objects.count, 1, @"Expecting a single instance");
+}
+
+/**
+Tests that the registry recovers when a factory raises.
+*/
+- (void)testFactoryException {
+    [Facade getInstance:@"MultitonRegistryTestKey1" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    
+    // A factory that constructs a second Facade for an existing key raises
+    XCTAssertThrows([Facade getInstance:@"MultitonRegistryTestKey2" factory:^(NSString *key) { return [Facade withKey:@"MultitonRegistryTestKey1"]; }],
+                    @"Expecting FacadeAlreadyExistsException");
+    
+    // The shard is not left locked for other threads
+    __block id<IFacade> facade = nil;
+    dispatch_group_t group = dispatch_group_create();
+    dispatch_group_async(group, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+        facade = [Facade getInstance:@"MultitonRegistryTestKey2" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    });
+    XCTAssertEqual(dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, 5 * NSEC_PER_SEC)), 0, @"Expecting getInstance not to block");
+    XCTAssertNotNil(facade, @"Expecting facade not nil");
+    
+    [Facade removeCore:@"MultitonRegistryTestKey1"];
+    [Facade removeCore:@"MultitonRegistryTestKey2"];
+    XCTAssertFalse([Facade hasCore:@"MultitonRegistryTestKey1"], @"Expecting [Facade hasCore:@'MultitonRegistryTestKey1'] == false");
+}
+
+/**
+Tests that factories creating instances under other keys do not
+deadlock when threads create keys on each other's shards.
+*/
+- (void)testNestedFactories {
+    MultitonRegistry<NSString *> *registry = [MultitonRegistry registry];
+    dispatch_group_t group = dispatch_group_create();
+    for (int thread = 0; thread < 8; thread++) {
+        dispatch_group_async(group, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+            for (int i = 0; i < 200; i++) {
+                NSString *outer = [NSString stringWithFormat:@"Outer%d.%d", thread, i];
+                [registry objectForKey:outer factory:^NSString *(NSString *key) {
+                    // each factory creates a key another thread's factory may share a shard with
+                    NSString *inner = [NSString stringWithFormat:@"Inner%d", (i * 7 + thread) % 64];
+                    [registry objectForKey:inner factory:^NSString *(NSString *k) { return k; }];
+                    return key;
+                }];
+            }
+        });
+    }
+    
+    XCTAssertEqual(dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0, @"Expecting nested creation not to deadlock");
+    XCTAssertEqualObjects([registry objectForKey:@"Outer7.199"], @"Outer7.199", @"Expecting the outer instance registered");
+    XCTAssertEqualObjects([registry objectForKey:@"Inner0"], @"Inner0", @"Expecting the inner instance registered");
+}
+
+@end
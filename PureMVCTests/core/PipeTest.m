@@ -0,0 +1,153 @@
+//
+//  PipeTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import <stdatomic.h>
+
+@interface PipeTest : XCTestCase
+
+@end
+
+@implementation PipeTest {
+    /// Notifications received by the observer.
+    NSMutableArray<id<INotification>> *_notifications;
+    
+    /// Number of notifications received, and the number awaited.
+    atomic_long _received;
+    atomic_long _expected;
+    
+    /// Signaled once the awaited number of notifications is received.
+    dispatch_semaphore_t _done;
+    
+    /// The thread notifications were last delivered on.
+    NSThread *_deliveryThread;
+}
+
+- (void)setUp {
+    _notifications = [NSMutableArray array];
+    atomic_store(&_received, 0);
+    atomic_store(&_expected, 0);
+    _done = dispatch_semaphore_create(0);
+}
+
+/**
+Observer recording each notification delivered through a pipe.
+*/
+- (void)onRecord:(id<INotification>)notification {
+    [_notifications addObject:notification];
+    _deliveryThread = [NSThread currentThread];
+    [self onCount:notification];
+}
+
+/**
+Observer counting notifications, signaling once the awaited number is received.
+*/
+- (void)onCount:(id<INotification>)notification {
+    if (atomic_fetch_add(&_received, 1) + 1 == atomic_load(&_expected)) dispatch_semaphore_signal(_done);
+}
+
+/**
+Set the total number of notifications to await, before writing them.
+
+- parameter count: the total number of notifications to await
+*/
+- (void)expectNotifications:(long)count {
+    atomic_store(&_expected, count);
+}
+
+/**
+Wait for the expected number of notifications.
+
+- returns: YES if they were all received within 10 seconds
+*/
+- (BOOL)awaitNotifications {
+    return dispatch_semaphore_wait(_done, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)) == 0;
+}
+
+/**
+Tests that notifications written to a pipe are delivered in order to the observers of its Core
+*/
+- (void)testWrite {
+    id<IView> view = [View getInstance:@"PipeTestKey1" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"PipeTestNote" observer:[Observer withNotify:@selector(onRecord:) context:self]];
+    
+    Pipe *pipe = [Pipe getInstance:@"PipeTestKey1" factory:^(NSString *key) { return [Pipe withKey:key]; }];
+    [self expectNotifications:100];
+    for (int i = 0; i < 100; i++) {
+        XCTAssertTrue([pipe write:[Notification withName:@"PipeTestNote" body:@(i)]], @"Expecting write to succeed");
+    }
+    
+    XCTAssertTrue([self awaitNotifications], @"Expecting 100 notifications");
+    for (int i = 0; i < 100; i++) {
+        XCTAssertEqualObjects(_notifications[i].body, @(i), @"Expecting notifications in write order");
+    }
+    XCTAssertFalse(_deliveryThread == [NSThread currentThread], @"Expecting delivery off the writing thread");
+    
+    [Facade removeCore:@"PipeTestKey1"];
+}
+
+/**
+Tests that writes fail once the pipe is full, and succeed again once it drains
+*/
+- (void)testFull {
+    id<IView> view = [View getInstance:@"PipeTestKey2" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"PipeTestNote" observer:[Observer withNotify:@selector(onCount:) context:self]];
+    
+    Pipe *pipe = [Pipe getInstance:@"PipeTestKey2" factory:^(NSString *key) { return [Pipe withKey:key capacity:3]; }];
+    XCTAssertEqual(pipe.capacity, (NSUInteger)4, @"Expecting capacity rounded up to 4");
+    
+    // hold the executor so nothing drains
+    [self expectNotifications:4];
+    dispatch_suspend(pipe.executor);
+    for (int i = 0; i < 4; i++) {
+        XCTAssertTrue([pipe write:[Notification withName:@"PipeTestNote"]], @"Expecting write to succeed");
+    }
+    XCTAssertFalse([pipe write:[Notification withName:@"PipeTestNote"]], @"Expecting write to a full pipe to fail");
+    dispatch_resume(pipe.executor);
+    
+    XCTAssertTrue([self awaitNotifications], @"Expecting 4 notifications");
+    [self expectNotifications:5];
+    XCTAssertTrue([pipe write:[Notification withName:@"PipeTestNote"]], @"Expecting write to succeed after draining");
+    XCTAssertTrue([self awaitNotifications], @"Expecting 5 notifications");
+    
+    [Facade removeCore:@"PipeTestKey2"];
+}
+
+/**
+Tests that removing a Core closes its pipe
+*/
+- (void)testRemoveCore {
+    [Facade getInstance:@"PipeTestKey3" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    Pipe *pipe = [Pipe getInstance:@"PipeTestKey3" factory:^(NSString *key) { return [Pipe withKey:key]; }];
+    
+    [Facade removeCore:@"PipeTestKey3"];
+    
+    XCTAssertFalse([pipe write:[Notification withName:@"PipeTestNote"]], @"Expecting write to a closed pipe to fail");
+    XCTAssertFalse([Pipe getInstance:@"PipeTestKey3" factory:^(NSString *key) { return [Pipe withKey:key]; }] == pipe, @"Expecting a new pipe instance");
+    
+    [Facade removeCore:@"PipeTestKey3"];
+}
+
+/**
+Tests that writing to a Core without a pipe fails, and creates neither a pipe nor a View
+*/
+- (void)testWriteToCoreWithoutPipe {
+    XCTAssertFalse([Pipe write:[Notification withName:@"PipeTestNote"] toCore:@"PipeTestKey8"], @"Expecting write to fail");
+    
+    Pipe *pipe = [Pipe getInstance:@"PipeTestKey8" factory:^(NSString *key) { return [Pipe withKey:key]; }];
+    XCTAssertTrue([Pipe write:[Notification withName:@"PipeTestNote"] toCore:@"PipeTestKey8"], @"Expecting write to succeed once the pipe exists");
+    
+    // wait for the drain, which finds no View to deliver to
+    dispatch_sync(pipe.executor, ^{});
+    XCTAssertNil([View viewForKey:@"PipeTestKey8"], @"Expecting no View created by the drain");
+    
+    [Pipe removePipe:@"PipeTestKey8"];
+}
+
+@end
@@ -0,0 +1,188 @@
+//
+//  SharedMemoryTransportTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import <fcntl.h>
+#import <stdatomic.h>
+#import <string.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <unistd.h>
+#import "NotificationCodecTestBodyCodec.h"
+
+@interface SharedMemoryTransportTest : XCTestCase
+
+@end
+
+@implementation SharedMemoryTransportTest {
+    /// Notifications received by the observer.
+    NSMutableArray<id<INotification>> *_notifications;
+    
+    /// Number of notifications received, and the number awaited.
+    atomic_long _received;
+    atomic_long _expected;
+    
+    /// Signaled once the awaited number of notifications is received.
+    dispatch_semaphore_t _done;
+}
+
+- (void)setUp {
+    _notifications = [NSMutableArray array];
+    atomic_store(&_received, 0);
+    atomic_store(&_expected, 0);
+    _done = dispatch_semaphore_create(0);
+}
+
+/**
+Observer recording each notification received through the transport.
+*/
+- (void)onRecord:(id<INotification>)notification {
+    [_notifications addObject:notification];
+    [self onCount:notification];
+}
+
+/**
+Observer counting notifications, signaling once the awaited number is received.
+*/
+- (void)onCount:(id<INotification>)notification {
+    if (atomic_fetch_add(&_received, 1) + 1 == atomic_load(&_expected)) dispatch_semaphore_signal(_done);
+}
+
+/**
+A segment name unique to this process, within the 31 character limit of some platforms.
+
+- parameter suffix: distinguishes segments within a test
+- returns: the segment name
+*/
+- (NSString *)segmentName:(NSString *)suffix {
+    return [NSString stringWithFormat:@"/pmvc.%d.%@", getpid(), suffix];
+}
+
+/**
+Tests that notifications written on one side are delivered to the Core on the other side
+*/
+- (void)testWrite {
+    NSError *error = nil;
+    SharedMemoryTransport *creator = [SharedMemoryTransport createWithName:[self segmentName:@"1"] key:@"SharedMemoryTransportTestKey1" capacity:4096 error:&error];
+    XCTAssertNotNil(creator, @"Expecting segment created, %@", error);
+    SharedMemoryTransport *opener = [SharedMemoryTransport openWithName:[self segmentName:@"1"] key:@"SharedMemoryTransportTestKey2" error:&error];
+    XCTAssertNotNil(opener, @"Expecting segment opened, %@", error);
+    XCTAssertEqual(opener.capacity, creator.capacity, @"Expecting the same capacity on both sides");
+    
+    id<IView> view = [View getInstance:@"SharedMemoryTransportTestKey2" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"SharedMemoryTransportTestNote" observer:[Observer withNotify:@selector(onRecord:) context:self]];
+    
+    // enough writes to wrap the ring several times
+    atomic_store(&_expected, 200);
+    NSData *body = [@"0123456789abcdef0123456789abcdef" dataUsingEncoding:NSUTF8StringEncoding];
+    for (int i = 0; i < 200; i++) {
+        id<INotification> notification = [Notification withName:@"SharedMemoryTransportTestNote" body:(i % 2 == 0 ? body : nil) type:[NSString stringWithFormat:@"%d", i]];
+        while (![creator write:notification]) usleep(100);
+    }
+    XCTAssertEqual(dispatch_semaphore_wait(_done, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0L, @"Expecting 200 notifications");
+    
+    for (int i = 0; i < 200; i++) {
+        XCTAssertEqualObjects(_notifications[i].name, @"SharedMemoryTransportTestNote", @"Expecting the written name");
+        XCTAssertEqualObjects(_notifications[i].type, ([NSString stringWithFormat:@"%d", i]), @"Expecting the written type, in order");
+        XCTAssertEqualObjects(_notifications[i].body, (i % 2 == 0 ? body : nil), @"Expecting the written body");
+    }
+    
+    [opener close];
+    [creator close];
+    [Facade removeCore:@"SharedMemoryTransportTestKey2"];
+}
+
+/**
+Tests notifications written through a codec, with bodies that are not NSData
+*/
+- (void)testWriteWithCodec {
+    SharedMemoryTransport *creator = [SharedMemoryTransport createWithName:[self segmentName:@"5"] key:@"SharedMemoryTransportTestKey7" capacity:4096 error:nil];
+    SharedMemoryTransport *opener = [SharedMemoryTransport openWithName:[self segmentName:@"5"] key:@"SharedMemoryTransportTestKey8" error:nil];
+    creator.codec = [NotificationCodec withNames:@[@"SharedMemoryTransportTestNote"] bodyCodec:[[NotificationCodecTestBodyCodec alloc] init]];
+    opener.codec = creator.codec;
+    
+    id<IView> view = [View getInstance:@"SharedMemoryTransportTestKey8" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"SharedMemoryTransportTestNote" observer:[Observer withNotify:@selector(onRecord:) context:self]];
+    
+    atomic_store(&_expected, 1);
+    XCTAssertTrue([creator write:[Notification withName:@"SharedMemoryTransportTestNote" body:@"string" type:@"Type"]], @"Expecting write to succeed");
+    XCTAssertEqual(dispatch_semaphore_wait(_done, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0L, @"Expecting 1 notification");
+    
+    XCTAssertEqualObjects(_notifications[0].body, @"string", @"Expecting the string body");
+    XCTAssertEqualObjects(_notifications[0].type, @"Type", @"Expecting the written type");
+    
+    [opener close];
+    [creator close];
+    [Facade removeCore:@"SharedMemoryTransportTestKey8"];
+}
+
+/**
+Tests the limits of what can be written
+*/
+- (void)testWriteLimits {
+    SharedMemoryTransport *creator = [SharedMemoryTransport createWithName:[self segmentName:@"2"] key:@"SharedMemoryTransportTestKey3" capacity:4096 error:nil];
+    
+    XCTAssertThrowsSpecificNamed([creator write:[Notification withName:@"SharedMemoryTransportTestNote" body:@"not data"]], NSException, @"SharedMemoryTransportException", @"Expecting SharedMemoryTransportException");
+    XCTAssertFalse([creator write:[Notification withName:@"SharedMemoryTransportTestNote" body:[NSMutableData dataWithLength:4096]]], @"Expecting a body larger than half the ring to fail");
+    
+    [creator close];
+    XCTAssertFalse([creator write:[Notification withName:@"SharedMemoryTransportTestNote"]], @"Expecting write after close to fail");
+}
+
+/**
+Tests the errors reported when a segment can't be created or opened
+*/
+- (void)testErrors {
+    NSError *error = nil;
+    XCTAssertNil([SharedMemoryTransport openWithName:[self segmentName:@"none"] key:@"SharedMemoryTransportTestKey4" error:&error], @"Expecting a missing segment to fail");
+    XCTAssertEqualObjects(error.domain, NSPOSIXErrorDomain, @"Expecting a POSIX error");
+    
+    SharedMemoryTransport *creator = [SharedMemoryTransport createWithName:[self segmentName:@"3"] key:@"SharedMemoryTransportTestKey4" capacity:4096 error:nil];
+    XCTAssertNil([SharedMemoryTransport createWithName:[self segmentName:@"3"] key:@"SharedMemoryTransportTestKey4" capacity:4096 error:&error], @"Expecting an existing segment to fail");
+    XCTAssertEqual(error.code, (NSInteger)EEXIST, @"Expecting EEXIST");
+    [creator close];
+}
+
+/**
+Tests that a record whose length runs past the ring closes the reading side
+*/
+- (void)testMalformedRecordClosesTransport {
+    NSString *name = [self segmentName:@"5"];
+    SharedMemoryTransport *creator = [SharedMemoryTransport createWithName:name key:@"SharedMemoryTransportTestKey7" capacity:4096 error:nil];
+    SharedMemoryTransport *opener = [SharedMemoryTransport openWithName:name key:@"SharedMemoryTransportTestKey8" error:nil];
+    
+    // hold off the creator's reader while the record is corrupted
+    creator.pollInterval = 3600;
+    XCTAssertTrue([opener write:[Notification withName:@"SharedMemoryTransportTestBad"]], @"Expecting write to succeed");
+    
+    int fd = shm_open(name.fileSystemRepresentation, O_RDWR, 0);
+    struct stat info;
+    fstat(fd, &info);
+    uint8_t *segment = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    uint8_t *found = memmem(segment, (size_t)info.st_size, "SharedMemoryTransportTestBad", 28);
+    XCTAssertTrue(found != NULL, @"Expecting the record in the segment");
+    
+    // the record header and the payload header precede the name, 8 bytes each
+    uint32_t length = 0x7FFFFFF0;
+    memcpy(found - 16, &length, sizeof(length));
+    munmap(segment, (size_t)info.st_size);
+    
+    creator.pollInterval = 0.001;
+    BOOL open = YES;
+    for (int i = 0; i < 500 && open; i++) {
+        usleep(10000);
+        open = [creator write:[Notification withName:@"SharedMemoryTransportTestNote"]];
+    }
+    XCTAssertFalse(open, @"Expecting the creator closed by the malformed record");
+    
+    [opener close];
+}
+
+@end
@@ -0,0 +1,181 @@
+//
+//  TracerTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <pthread.h>
+#import <PureMVC/PureMVC.h>
+#import "MacroCommandTestCommand.h"
+#import "MacroCommandTestVO.h"
+
+@interface TracerTest : XCTestCase
+
+@end
+
+/**
+Record one span on a thread of its own.
+
+- parameter name: the span's name, an `NSString`
+- returns: NULL
+*/
+static void *traceOnThread(void *name) {
+    [Tracer endSpan:[Tracer beginSpan:TraceCategoryNotify name:(__bridge NSString *)name core:nil]];
+    return NULL;
+}
+
+@implementation TracerTest
+
+- (void)setUp {
+    [Tracer reset];
+    Tracer.enabled = YES;
+}
+
+- (void)tearDown {
+    Tracer.enabled = NO;
+    [Tracer reset];
+}
+
+/**
+The complete events of the trace.
+
+- returns: the `"X"` events of `traceEventJSON`
+*/
+- (NSArray<NSDictionary *> *)spans {
+    NSDictionary *trace = [NSJSONSerialization JSONObjectWithData:[Tracer traceEventJSON] options:0 error:nil];
+    return [trace[@"traceEvents"] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"ph == 'X'"]];
+}
+
+/**
+The first span with a name.
+
+- parameter name: the name of the span
+- parameter spans: the spans to search
+- returns: the span, or nil
+*/
+- (nullable NSDictionary *)span:(NSString *)name in:(NSArray<NSDictionary *> *)spans {
+    return [spans filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"name == %@", name]].firstObject;
+}
+
+/**
+Tests that a notification executing a `MacroCommand` is traced as a tree of spans.
+*/
+- (void)testSpanTree {
+    id<IController> controller = [Controller getInstance:@"TracerTestKey1" factory:^(NSString *key) { return [Controller withKey:key]; }];
+    id<IView> view = [View getInstance:@"TracerTestKey1" factory:^(NSString *key) { return [View withKey:key]; }];
+    [controller registerCommand:@"TracerTest" factory:^() { return [MacroCommandTestCommand command]; }];
+    
+    MacroCommandTestVO *vo = [[MacroCommandTestVO alloc] initWithInput:5];
+    [view notifyObservers:[Notification withName:@"TracerTest" body:vo]];
+    
+    NSArray<NSDictionary *> *spans = [self spans];
+    NSDictionary *notify = [self span:@"TracerTest" in:spans];
+    NSDictionary *observer = [self span:@"Controller" in:spans];
+    NSDictionary *command = [self span:@"MacroCommandTestCommand" in:spans];
+    NSDictionary *sub1 = [self span:@"MacroCommandTestSub1Command" in:spans];
+    NSDictionary *sub2 = [self span:@"MacroCommandTestSub2Command" in:spans];
+    
+    XCTAssertEqual(spans.count, (NSUInteger)5, @"Expecting 5 spans");
+    XCTAssertEqualObjects(notify[@"cat"], @"notify", @"Expecting a notify span");
+    XCTAssertNil(notify[@"args"][@"parent"], @"Expecting the notify span to be the root");
+    XCTAssertEqualObjects(observer[@"args"][@"parent"], notify[@"args"][@"span"], @"Expecting the observer inside the notify");
+    XCTAssertEqualObjects(command[@"args"][@"parent"], observer[@"args"][@"span"], @"Expecting the command inside the observer");
+    XCTAssertEqualObjects(sub1[@"args"][@"parent"], command[@"args"][@"span"], @"Expecting the first SubCommand inside the command");
+    XCTAssertEqualObjects(sub2[@"args"][@"parent"], command[@"args"][@"span"], @"Expecting the second SubCommand inside the command");
+    XCTAssertEqualObjects(sub2[@"cat"], @"subcommand", @"Expecting a subcommand span");
+    XCTAssertEqualObjects(sub2[@"args"][@"core"], @"TracerTestKey1", @"Expecting the SubCommand to inherit the core");
+    XCTAssertGreaterThanOrEqual([notify[@"dur"] doubleValue], [command[@"dur"] doubleValue], @"Expecting the notify to outlast the command");
+    XCTAssertEqual(vo.result2, 25, @"Expecting the MacroCommand executed");
+    
+    [Controller removeController:@"TracerTestKey1"];
+    [View removeView:@"TracerTestKey1"];
+}
+
+/**
+Tests that ending a span ends the spans still open inside it.
+*/
+- (void)testEndSpanEndsChildren {
+    uint64_t outer = [Tracer beginSpan:TraceCategoryNotify name:@"Outer" core:@"TracerTestKey2"];
+    uint64_t inner = [Tracer beginSpan:TraceCategoryObserver name:[self class] core:nil];
+    [Tracer endSpan:outer];
+    [Tracer endSpan:inner];
+    
+    NSArray<NSDictionary *> *spans = [self spans];
+    XCTAssertEqual(spans.count, (NSUInteger)2, @"Expecting both spans recorded once");
+    XCTAssertEqualObjects([self span:@"TracerTest" in:spans][@"args"][@"parent"], @(outer), @"Expecting the inner span inside the outer");
+    XCTAssertEqualObjects([self span:@"TracerTest" in:spans][@"args"][@"core"], @"TracerTestKey2", @"Expecting the inner span to inherit the core");
+}
+
+/**
+Tests that nothing is traced while disabled, and that reset discards spans.
+*/
+- (void)testDisabledAndReset {
+    id<IView> view = [View getInstance:@"TracerTestKey3" factory:^(NSString *key) { return [View withKey:key]; }];
+    Tracer.enabled = NO;
+    [view notifyObservers:[Notification withName:@"TracerTest"]];
+    XCTAssertEqual([self spans].count, (NSUInteger)0, @"Expecting nothing traced");
+    
+    Tracer.enabled = YES;
+    [view notifyObservers:[Notification withName:@"TracerTest"]];
+    XCTAssertEqual([self spans].count, (NSUInteger)1, @"Expecting the notify traced");
+    
+    [Tracer reset];
+    XCTAssertEqual([self spans].count, (NSUInteger)0, @"Expecting the spans discarded");
+    
+    [View removeView:@"TracerTestKey3"];
+}
+
+/**
+Tests that threads trace concurrently into their own buffers.
+*/
+- (void)testConcurrentSpans {
+    dispatch_apply(8, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        for (int n = 0; n < 1000; n++) {
+            uint64_t span = [Tracer beginSpan:TraceCategoryNotify name:@"Concurrent" core:nil];
+            [Tracer endSpan:span];
+        }
+    });
+    
+    NSArray<NSDictionary *> *spans = [self spans];
+    XCTAssertEqual(spans.count, (NSUInteger)8000, @"Expecting every span recorded");
+    XCTAssertEqual([[NSSet setWithArray:[spans valueForKeyPath:@"args.span"]] count], (NSUInteger)8000, @"Expecting unique span ids");
+}
+
+/**
+Tests that the spans of exited threads are exported, each under its
+own thread, after the second thread reuses the first one's buffer.
+*/
+- (void)testExitedThreadSpans {
+    pthread_t thread;
+    pthread_create(&thread, NULL, traceOnThread, (__bridge void *)@"Exited1");
+    pthread_join(thread, NULL);
+    pthread_create(&thread, NULL, traceOnThread, (__bridge void *)@"Exited2");
+    pthread_join(thread, NULL);
+    
+    NSArray<NSDictionary *> *spans = [self spans];
+    NSDictionary *first = [self span:@"Exited1" in:spans];
+    NSDictionary *second = [self span:@"Exited2" in:spans];
+    XCTAssertNotNil(first, @"Expecting the first thread's span exported");
+    XCTAssertNotNil(second, @"Expecting the second thread's span exported");
+    XCTAssertNotEqualObjects(first[@"tid"], second[@"tid"], @"Expecting each span under its own thread");
+}
+
+/**
+Tests that the trace is written as JSON.
+*/
+- (void)testWriteToURL {
+    [Tracer endSpan:[Tracer beginSpan:TraceCategoryCommand name:@"Written" core:nil]];
+    NSURL *url = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:@"TracerTest.json"];
+    
+    NSError *error = nil;
+    XCTAssertTrue([Tracer writeToURL:url error:&error], @"Expecting the trace written, %@", error);
+    NSDictionary *trace = [NSJSONSerialization JSONObjectWithData:[NSData dataWithContentsOfURL:url] options:0 error:nil];
+    XCTAssertNotNil(trace[@"traceEvents"], @"Expecting a traceEvents array");
+    
+    [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+}
+
+@end
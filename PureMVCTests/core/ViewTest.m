@@ -375,4 +375,112 @@ themselves.
     XCTAssertTrue(vo.counter == 0, @"Expecting vo.counter == 0");
 }
 
+/**
+Tests that a Mediator handle tracks registration, removal and re-registration.
+*/
+- (void)testRetrieveMediatorHandle {
+    id<IView> view = [View getInstance:@"ViewTestKey12" factory:^(NSString *key) { return [View withKey:key]; }];
+    
+    // Resolve a handle before anything is registered
+    id<IHandle> handle = [view retrieveMediatorHandle:@"handled"];
+    XCTAssertNil(handle.target, @"Expecting handle.target == nil");
+    XCTAssertEqual([view retrieveMediatorHandle:@"handled"], handle, @"Expecting the same handle instance");
+    
+    // Register, remove and register a new instance
+    id<IMediator> mediator = [Mediator withName:@"handled" component:self];
+    [view registerMediator:mediator];
+    XCTAssertEqual(handle.target, mediator, @"Expecting handle.target == mediator");
+    
+    [view removeMediator:@"handled"];
+    XCTAssertNil(handle.target, @"Expecting handle.target == nil");
+    
+    id<IMediator> mediator2 = [Mediator withName:@"handled" component:self];
+    [view registerMediator:mediator2];
+    XCTAssertEqual(handle.target, mediator2, @"Expecting handle.target == mediator2");
+}
+
+/**
+Tests that introspect reports observer counts, dead contexts and mediators.
+*/
+- (void)testIntrospect {
+    id<IView> view = [View getInstance:@"ViewTestKey13" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerMediator:[ViewTestMediator2 withName:[ViewTestMediator2 NAME] component:self]];
+    
+    // Register an observer whose context is released right away
+    @autoreleasepool {
+        NSObject *context = [[NSObject alloc] init];
+        [view registerObserver:NOTE1 observer:[Observer withNotify:@selector(description) context:context]];
+    }
+    
+    NSDictionary<NSString *, id> *snapshot = [view introspect];
+    XCTAssertTrue([NSJSONSerialization isValidJSONObject:snapshot], @"Expecting a JSON-compatible snapshot");
+    XCTAssertEqualObjects(snapshot[@"key"], @"ViewTestKey13", @"Expecting the multiton key");
+    
+    NSDictionary *note1 = snapshot[@"notifications"][NOTE1];
+    XCTAssertEqualObjects(note1[@"observers"], @2, @"Expecting 2 observers of NOTE1");
+    XCTAssertEqualObjects(note1[@"live"], @1, @"Expecting 1 live observer of NOTE1");
+    XCTAssertEqualObjects(note1[@"contexts"][0][@"class"], @"ViewTestMediator2", @"Expecting the mediator's class");
+    XCTAssertEqualObjects(note1[@"contexts"][1][@"alive"], @NO, @"Expecting the released context reported dead");
+    XCTAssertEqualObjects(snapshot[@"notifications"][NOTE2][@"observers"], @1, @"Expecting 1 observer of NOTE2");
+    
+    NSArray *mediators = snapshot[@"mediators"];
+    XCTAssertEqual(mediators.count, 1U, @"Expecting 1 mediator");
+    XCTAssertEqualObjects(mediators[0][@"name"], [ViewTestMediator2 NAME], @"Expecting the mediator's name");
+}
+
+/**
+Tests that removeAllMediators removes only the mediators'
+observers, and that a mediator registered again is
+notified once.
+*/
+- (void)testRemoveAllMediatorsAndReregister {
+    View *view = (View *)[View getInstance:@"ViewTestKey14" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"ViewTestRemoveAll" observer:[Observer withNotify:@selector(viewTestMethod:) context:self]];
+    [view registerMediator:[ViewTestMediator5 withComponent:self]];
+    
+    NSArray<id<IMediator>> *removed = [view removeAllMediators];
+    XCTAssertTrue(removed.count == 1, @"Expecting removed.count == 1");
+    
+    ViewTestVO *vo = [[ViewTestVO alloc] init];
+    vo.counter = 0;
+    [view notifyObservers:[Notification withName:NOTE5 body:vo]];
+    XCTAssertTrue(vo.counter == 0, @"Expecting counter == 0");
+    
+    // an observer registered by someone else is left in place
+    viewTestVar = 0;
+    [view notifyObservers:[Notification withName:@"ViewTestRemoveAll" body:@10]];
+    XCTAssertTrue(viewTestVar == 10, @"Expecting viewTestVar == 10");
+    
+    [view registerMediator:[ViewTestMediator5 withComponent:self]];
+    [view notifyObservers:[Notification withName:NOTE5 body:vo]];
+    XCTAssertTrue(vo.counter == 1, @"Expecting counter == 1");
+    
+    [View removeView:@"ViewTestKey14"];
+}
+
+/**
+Tests that removeObservers:context: removes a context's observer
+from every given notification, leaving other contexts in place.
+*/
+- (void)testRemoveObserversWithContext {
+    View *view = (View *)[View getInstance:@"ViewTestKey15" factory:^(NSString *key) { return [View withKey:key]; }];
+    id<IObserver> observer = [Observer withNotify:@selector(viewTestMethod:) context:self];
+    [view registerObserver:observer notificationNames:@[@"ViewTestNote1", @"ViewTestNote2"]];
+    [view registerMediator:[ViewTestMediator5 withComponent:self]];
+    
+    [view removeObservers:@[@"ViewTestNote1", @"ViewTestNote2", NOTE5] context:self];
+    
+    viewTestVar = 0;
+    [view notifyObservers:[Notification withName:@"ViewTestNote1" body:@10]];
+    [view notifyObservers:[Notification withName:@"ViewTestNote2" body:@10]];
+    XCTAssertTrue(viewTestVar == 0, @"Expecting viewTestVar == 0");
+    
+    ViewTestVO *vo = [[ViewTestVO alloc] init];
+    vo.counter = 0;
+    [view notifyObservers:[Notification withName:NOTE5 body:vo]];
+    XCTAssertTrue(vo.counter == 1, @"Expecting the mediator's observer left in place");
+    
+    [View removeView:@"ViewTestKey15"];
+}
+
 @end
@@ -0,0 +1,125 @@
+//
+//  WatchdogTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import <unistd.h>
+#import "ControllerTestCommand.h"
+#import "ControllerTestVO.h"
+
+@interface WatchdogTest : XCTestCase
+
+@end
+
+@implementation WatchdogTest
+
+- (void)tearDown {
+    Watchdog.enabled = NO;
+}
+
+/**
+Observer doing nothing.
+*/
+- (void)onNotification:(id<INotification>)notification {
+    
+}
+
+/**
+Observer taking 2 ms.
+*/
+- (void)onSlowNotification:(id<INotification>)notification {
+    usleep(2000);
+}
+
+/**
+Tests that an observer over its notification's budget is reported with its context class.
+*/
+- (void)testObserverOverrun {
+    View *view = (View *)[View getInstance:@"WatchdogTestKey1" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"Watched" observer:[Observer withNotify:@selector(onNotification:) context:self]];
+    [view registerObserver:@"Watched" observer:[Observer withNotify:@selector(onSlowNotification:) context:self]];
+    NSMutableArray<NSString *> *reported = [NSMutableArray array];
+    __block uint64_t reportedLatency = 0;
+    view.watchdog.handler = ^(NSString *key, NSString *name, Class contextClass, uint64_t latency, uint64_t budget) {
+        [reported addObject:[NSString stringWithFormat:@"%@ %@ %@", key, name, NSStringFromClass(contextClass)]];
+        reportedLatency = latency;
+    };
+    [view.watchdog setBudget:1000000 forNotification:@"Watched"];
+    Watchdog.enabled = YES;
+    
+    [view notifyObservers:[Notification withName:@"Watched"]];
+    [view notifyObservers:[Notification withName:@"Unwatched"]];
+    
+    XCTAssertEqual(reported.count, (NSUInteger)1, @"Expecting only the slow observer reported");
+    XCTAssertEqualObjects(reported.firstObject, @"WatchdogTestKey1 Watched WatchdogTest", @"Expecting the Core, notification and context class");
+    XCTAssertGreaterThan(reportedLatency, 1000000ULL, @"Expecting the latency over budget");
+    XCTAssertEqual(view.watchdog.violationCount, 1ULL, @"Expecting 1 violation");
+    [View removeView:@"WatchdogTestKey1"];
+}
+
+/**
+Tests that a context class's budget takes precedence over its notification's, and that 0 removes a budget.
+*/
+- (void)testBudgetPrecedence {
+    Watchdog *watchdog = [Watchdog withKey:@"WatchdogTestKey2"];
+    watchdog.defaultBudget = 10;
+    [watchdog setBudget:20 forNotification:@"Watched"];
+    [watchdog setBudget:30 forContextClass:[self class]];
+    
+    XCTAssertEqual([watchdog budgetForNotification:@"Watched" contextClass:[self class]], 30ULL, @"Expecting the class budget");
+    XCTAssertEqual([watchdog budgetForNotification:@"Watched" contextClass:[NSObject class]], 20ULL, @"Expecting the notification budget");
+    XCTAssertEqual([watchdog budgetForNotification:@"Other" contextClass:[NSObject class]], 10ULL, @"Expecting the default budget");
+    XCTAssertFalse([watchdog checkNotification:@"Watched" contextClass:[self class] latency:25], @"Expecting 25 within the class budget");
+    
+    watchdog.handler = ^(NSString *key, NSString *name, Class contextClass, uint64_t latency, uint64_t budget) {};
+    [watchdog setBudget:0 forContextClass:[self class]];
+    XCTAssertTrue([watchdog checkNotification:@"Watched" contextClass:[self class] latency:25], @"Expecting 25 over the notification budget");
+    
+    [watchdog removeAllBudgets];
+    XCTAssertFalse([watchdog checkNotification:@"Watched" contextClass:[self class] latency:UINT64_MAX], @"Expecting no budget");
+    XCTAssertEqual(watchdog.violationCount, 1ULL, @"Expecting 1 violation");
+}
+
+/**
+Tests that an overrunning command is reported with the command class rather than the Controller's.
+*/
+- (void)testCommandOverrun {
+    id<IController> controller = [Controller getInstance:@"WatchdogTestKey3" factory:^(NSString *key) { return [Controller withKey:key]; }];
+    [controller registerCommand:@"WatchdogTest" factory:^() { return [ControllerTestCommand command]; }];
+    View *view = (View *)[View getInstance:@"WatchdogTestKey3" factory:^(NSString *key) { return [View withKey:key]; }];
+    NSMutableArray<Class> *reported = [NSMutableArray array];
+    view.watchdog.handler = ^(NSString *key, NSString *name, Class contextClass, uint64_t latency, uint64_t budget) {
+        [reported addObject:contextClass];
+    };
+    [view.watchdog setBudget:1 forNotification:@"WatchdogTest"];
+    Watchdog.enabled = YES;
+    
+    [view notifyObservers:[Notification withName:@"WatchdogTest" body:[[ControllerTestVO alloc] initWithInput:12]]];
+    
+    XCTAssertEqual(reported.count, (NSUInteger)1, @"Expecting the command reported once");
+    XCTAssertEqualObjects(reported.firstObject, [ControllerTestCommand class], @"Expecting the command class");
+    [Controller removeController:@"WatchdogTestKey3"];
+    [View removeView:@"WatchdogTestKey3"];
+}
+
+/**
+Tests that nothing is checked while the watchdog is off.
+*/
+- (void)testDisabled {
+    View *view = (View *)[View getInstance:@"WatchdogTestKey4" factory:^(NSString *key) { return [View withKey:key]; }];
+    [view registerObserver:@"Watched" observer:[Observer withNotify:@selector(onSlowNotification:) context:self]];
+    [view.watchdog setBudget:1 forNotification:@"Watched"];
+    
+    [view notifyObservers:[Notification withName:@"Watched"]];
+    
+    XCTAssertFalse(Watchdog.isEnabled, @"Expecting the watchdog off by default");
+    XCTAssertEqual(view.watchdog.violationCount, 0ULL, @"Expecting no violations");
+    [View removeView:@"WatchdogTestKey4"];
+}
+
+@end
@@ -0,0 +1,119 @@
+//
+//  CoreTemplateTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import "CoreTemplateTestMediator.h"
+#import "FacadeTestCommand.h"
+#import "FacadeTestVO.h"
+
+@interface CoreTemplateTest : XCTestCase
+
+@end
+
+@implementation CoreTemplateTest
+
+/**
+Register a startup set of commands, proxies and mediators one at a time.
+
+- parameter facade: the Facade to register with
+- parameter count: the number of commands and proxies to register
+*/
+- (void)registerStartup:(id<IFacade>)facade count:(int)count {
+    for (int i = 0; i < count; i++) {
+        [facade registerCommand:[NSString stringWithFormat:@"CoreTemplateTestNote%d", i] factory:^id<ICommand> { return [FacadeTestCommand command]; }];
+        [facade registerProxyFactory:^id<IProxy> { return [Proxy withName:[NSString stringWithFormat:@"CoreTemplateTestProxy%d", i] data:@(i)]; }
+                                name:[NSString stringWithFormat:@"CoreTemplateTestProxy%d", i]];
+    }
+    for (int i = 0; i < count / 5; i++) {
+        [facade registerMediator:[CoreTemplateTestMediator withName:[NSString stringWithFormat:@"CoreTemplateTestMediator%d", i] component:@(i)]];
+    }
+}
+
+/**
+Tests that a Core instantiated from a template has the commands, proxies and mediators of the captured Core
+*/
+- (void)testInstantiate {
+    id<IFacade> prototype = [Facade getInstance:@"CoreTemplateTestKey1" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    [prototype registerCommand:@"CoreTemplateTestCommand" factory:^id<ICommand> { return [FacadeTestCommand command]; }];
+    [prototype registerProxyFactory:^id<IProxy> { return [Proxy withName:@"CoreTemplateTestProxy" data:@"data"]; } name:@"CoreTemplateTestProxy"];
+    [prototype registerMediator:[CoreTemplateTestMediator withName:@"CoreTemplateTestMediator" component:@"component"]];
+    
+    CoreTemplate *template = [CoreTemplate withKey:@"CoreTemplateTestKey1"];
+    id<IFacade> facade = [template instantiateWithKey:@"CoreTemplateTestKey2"];
+    
+    XCTAssertNotNil(facade, @"Expecting facade not nil");
+    XCTAssertTrue([Facade hasCore:@"CoreTemplateTestKey2"], @"Expecting [Facade hasCore:@'CoreTemplateTestKey2'] == true");
+    XCTAssertFalse(facade == prototype, @"Expecting a new facade instance");
+    
+    // Assert the command is mapped and executed by the new Core
+    FacadeTestVO *vo = [[FacadeTestVO alloc] initWithInput:21];
+    [facade sendNotification:@"CoreTemplateTestCommand" body:vo];
+    XCTAssertTrue(vo.result == 42, @"Expecting vo.result == 42");
+    
+    // Assert the proxy is created lazily in the new Core
+    id<IProxy> proxy = [facade retrieveProxy:@"CoreTemplateTestProxy"];
+    XCTAssertEqualObjects(proxy.data, @"data", @"Expecting proxy.data == 'data'");
+    XCTAssertFalse(proxy == [prototype retrieveProxy:@"CoreTemplateTestProxy"], @"Expecting a new proxy instance");
+    
+    // Assert the mediator is a registered copy, notified independently of the prototype
+    CoreTemplateTestMediator *mediator = (CoreTemplateTestMediator *)[facade retrieveMediator:@"CoreTemplateTestMediator"];
+    CoreTemplateTestMediator *original = (CoreTemplateTestMediator *)[prototype retrieveMediator:@"CoreTemplateTestMediator"];
+    XCTAssertNotNil(mediator, @"Expecting mediator not nil");
+    XCTAssertFalse(mediator == original, @"Expecting a new mediator instance");
+    XCTAssertTrue(mediator.registered, @"Expecting mediator.registered == true");
+    
+    [facade sendNotification:[CoreTemplateTestMediator NOTE]];
+    XCTAssertEqual(mediator.handled, (NSUInteger)1, @"Expecting mediator.handled == 1");
+    XCTAssertEqual(original.handled, (NSUInteger)0, @"Expecting original.handled == 0");
+    
+    [Facade removeCore:@"CoreTemplateTestKey1"];
+    [Facade removeCore:@"CoreTemplateTestKey2"];
+}
+
+/**
+Tests that the template is not affected by later changes to the captured Core
+*/
+- (void)testTemplateIsImmutable {
+    id<IFacade> prototype = [Facade getInstance:@"CoreTemplateTestKey3" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    CoreTemplate *template = [CoreTemplate withKey:@"CoreTemplateTestKey3"];
+    [prototype registerCommand:@"CoreTemplateTestCommand" factory:^id<ICommand> { return [FacadeTestCommand command]; }];
+    
+    id<IFacade> facade = [template instantiateWithKey:@"CoreTemplateTestKey4"];
+    XCTAssertFalse([facade hasCommand:@"CoreTemplateTestCommand"], @"Expecting [facade hasCommand:@'CoreTemplateTestCommand'] == false");
+    
+    [Facade removeCore:@"CoreTemplateTestKey3"];
+    [Facade removeCore:@"CoreTemplateTestKey4"];
+}
+
+/**
+Tests that capturing a Core holding a registrant that can't be copied raises
+*/
+- (void)testCaptureRequiresCopying {
+    id<IFacade> prototype = [Facade getInstance:@"CoreTemplateTestKey5" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    [prototype registerProxy:[Proxy withName:@"CoreTemplateTestProxy" data:@"data"]];
+    
+    XCTAssertThrowsSpecificNamed([CoreTemplate withKey:@"CoreTemplateTestKey5"], NSException, @"CoreTemplateException", @"Expecting CoreTemplateException");
+    XCTAssertThrowsSpecificNamed([CoreTemplate withKey:@"CoreTemplateTestMissing"], NSException, @"CoreTemplateException", @"Expecting CoreTemplateException");
+    
+    [Facade removeCore:@"CoreTemplateTestKey5"];
+}
+
+/**
+Tests that instantiating over an existing Core raises
+*/
+- (void)testInstantiateExistingKey {
+    [Facade getInstance:@"CoreTemplateTestKey6" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    CoreTemplate *template = [CoreTemplate withKey:@"CoreTemplateTestKey6"];
+    
+    XCTAssertThrowsSpecificNamed([template instantiateWithKey:@"CoreTemplateTestKey6"], NSException, @"CoreTemplateException", @"Expecting CoreTemplateException");
+    
+    [Facade removeCore:@"CoreTemplateTestKey6"];
+}
+
+@end
@@ -0,0 +1,37 @@
+//
+//  CoreTemplateTestMediator.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef CoreTemplateTestMediator_h
+#define CoreTemplateTestMediator_h
+
+#import <Foundation/Foundation.h>
+#import <PureMVC/PureMVC.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+A copyable Mediator class used by CoreTemplateTest.
+
+`@see CoreTemplateTest`
+*/
+@interface CoreTemplateTestMediator : Mediator <NSCopying>
+
+/// The name of the notification this Mediator is interested in.
++ (NSString *)NOTE;
+
+/// Number of notifications handled by this instance.
+@property (nonatomic, assign) NSUInteger handled;
+
+/// Whether onRegister was called on this instance.
+@property (nonatomic, assign) BOOL registered;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* CoreTemplateTestMediator_h */
@@ -0,0 +1,35 @@
+//
+//  CoreTemplateTestMediator.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import "CoreTemplateTestMediator.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation CoreTemplateTestMediator
+
++ (NSString *)NOTE { return @"CoreTemplateTestNote"; }
+
+- (NSArray<NSString *> *)listNotificationInterests {
+    return @[[CoreTemplateTestMediator NOTE]];
+}
+
+- (void)handleNotification:(id<INotification>)notification {
+    self.handled++;
+}
+
+- (void)onRegister {
+    self.registered = YES;
+}
+
+- (id)copyWithZone:(nullable NSZone *)zone {
+    return [CoreTemplateTestMediator withName:self.name component:self.component];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
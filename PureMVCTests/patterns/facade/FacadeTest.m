@@ -9,7 +9,11 @@
 #import <XCTest/XCTest.h>
 #import <PureMVC/PureMVC.h>
 #import "FacadeTestCommand.h"
+#import "FacadeTestCommand2.h"
 #import "FacadeTestVO.h"
+#import "ModelTestProxy.h"
+#import "ViewTestMediator4.h"
+#import "ViewTestVO.h"
 
 @interface FacadeTest : XCTestCase
 
@@ -208,6 +212,22 @@ Test hasCommand method.
     XCTAssertFalse([facade hasCommand:@"facadeHasCommandTest"], @"Expecting [facade hasCommand:@'facadeHasCommandTest'] == false");
 }
 
+/**
+Tests lazy Proxy registration via the Facade.
+*/
+- (void)testRegisterProxyFactory {
+    // Register a Proxy factory with the Facade
+    id<IFacade> facade = [Facade getInstance:@"FacadeTestKey11" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    __block BOOL created = NO;
+    [facade registerProxyFactory:^() { created = YES; return [Proxy withName:@"colors" data:@[@"red", @"green", @"blue"]]; } name:@"colors"];
+    
+    // Assert the Proxy is not created until it is retrieved
+    XCTAssertFalse(created, @"Expecting created == false");
+    id<IProxy> proxy = [facade retrieveProxy:@"colors"];
+    XCTAssertTrue(created, @"Expecting created == true");
+    XCTAssertEqual([proxy.data count], 3, @"Expecting proxy.data.count == 3");
+}
+
 /**
 Tests the hasCore and removeCore methods
 */
@@ -229,4 +249,83 @@ Tests the hasCore and removeCore methods
     XCTAssertFalse([Facade hasCore:@"FacadeTestKey10"], @"Expecing [Facade hasCore:@'FacadeTestKey10'] == false");
 }
 
+/**
+Tests that removeCore tears down the Model, View and Controller and their registrants
+*/
+- (void)testRemoveCoreTearsDownActors {
+    __weak id<IFacade> weakFacade = nil;
+    __weak id<IModel> weakModel = nil;
+    __weak id<IView> weakView = nil;
+    __weak id<IController> weakController = nil;
+    id<IProxy> proxy = [ModelTestProxy proxy];
+    ViewTestVO *vo = [[ViewTestVO alloc] init];
+    
+    @autoreleasepool {
+        id<IFacade> facade = [Facade getInstance:@"FacadeTestKey12" factory:^(NSString *key) { return [Facade withKey:key]; }];
+        [facade registerProxy:proxy];
+        [facade registerMediator:[ViewTestMediator4 withComponent:vo]];
+        [facade registerCommand:@"FacadeTestNote" factory:^id<ICommand> { return [FacadeTestCommand command]; }];
+        
+        weakFacade = facade;
+        weakModel = [Model getInstance:@"FacadeTestKey12" factory:^(NSString *key) { return [Model withKey:key]; }];
+        weakView = [View getInstance:@"FacadeTestKey12" factory:^(NSString *key) { return [View withKey:key]; }];
+        weakController = [Controller getInstance:@"FacadeTestKey12" factory:^(NSString *key) { return [Controller withKey:key]; }];
+        
+        [Facade removeCore:@"FacadeTestKey12"];
+    }
+    
+    // Assert every registrant was notified of its removal
+    XCTAssertEqualObjects(proxy.data, [ModelTestProxy ON_REMOVE_CALLED], @"Expecting proxy.data == [ModelTestProxy ON_REMOVE_CALLED]");
+    XCTAssertTrue(vo.onRemoveCalled, @"Expecting vo.onRemoveCalled == true");
+    
+    // Assert the Core actors were all reclaimed
+    XCTAssertNil(weakFacade, @"Expecting facade to be deallocated");
+    XCTAssertNil(weakModel, @"Expecting model to be deallocated");
+    XCTAssertNil(weakView, @"Expecting view to be deallocated");
+    XCTAssertNil(weakController, @"Expecting controller to be deallocated");
+}
+
+/**
+Tests that registered proxies, mediators and commands are given the Core's key,
+so they reach its Facade
+*/
+- (void)testRegistrantsReachTheirFacade {
+    id<IFacade> facade = [Facade getInstance:@"FacadeTestKey14" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    Proxy *proxy = [Proxy withName:[ModelTestProxy NAME]];
+    Mediator *mediator = [Mediator withName:@"FacadeTestMediator"];
+    [facade registerProxy:proxy];
+    [facade registerMediator:mediator];
+    [facade registerCommand:@"FacadeTestNote" factory:^id<ICommand> { return [FacadeTestCommand2 command]; }];
+    
+    FacadeTestVO *vo = [[FacadeTestVO alloc] initWithInput:32];
+    [facade sendNotification:@"FacadeTestNote" body:vo type:[ModelTestProxy NAME]];
+    
+    XCTAssertEqual(proxy.facade, facade, @"Expecting the proxy to reach the Facade");
+    XCTAssertEqual(mediator.facade, facade, @"Expecting the mediator to reach the Facade");
+    XCTAssertTrue(vo.result == 64, @"Expecting the command to reach the Facade");
+    
+    [Facade removeCore:@"FacadeTestKey14"];
+}
+
+/**
+Tests that Cores created and removed repeatedly under one key are each torn down
+*/
+- (void)testCreateAndRemoveCoreRepeatedly {
+    for (NSUInteger i = 0; i < 100; i++) {
+        __weak id<IFacade> weakFacade = nil;
+        id<IProxy> proxy = [ModelTestProxy proxy];
+        @autoreleasepool {
+            id<IFacade> facade = [Facade getInstance:@"FacadeTestKey13" factory:^(NSString *key) { return [Facade withKey:key]; }];
+            [facade registerProxy:proxy];
+            [facade registerCommand:@"FacadeTestNote" factory:^id<ICommand> { return [FacadeTestCommand command]; }];
+            weakFacade = facade;
+            [Facade removeCore:@"FacadeTestKey13"];
+        }
+        
+        XCTAssertFalse([Facade hasCore:@"FacadeTestKey13"], @"Expecting [Facade hasCore:@\"FacadeTestKey13\"] false");
+        XCTAssertEqualObjects(proxy.data, [ModelTestProxy ON_REMOVE_CALLED], @"Expecting proxy.data == [ModelTestProxy ON_REMOVE_CALLED]");
+        XCTAssertNil(weakFacade, @"Expecting facade to be deallocated");
+    }
+}
+
 @end
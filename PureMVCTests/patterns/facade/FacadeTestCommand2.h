@@ -0,0 +1,30 @@
+//
+//  FacadeTestCommand2.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef FacadeTestCommand2_h
+#define FacadeTestCommand2_h
+
+#import <Foundation/Foundation.h>
+#import <PureMVC/PureMVC.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+A SimpleCommand subclass used by FacadeTest that reaches its Core through `facade`.
+
+`@see FacadeTest`
+
+`@see FacadeTestVO`
+*/
+@interface FacadeTestCommand2 : SimpleCommand
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* FacadeTestCommand2_h */
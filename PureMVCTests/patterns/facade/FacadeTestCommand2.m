@@ -0,0 +1,31 @@
+//
+//  FacadeTestCommand2.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import "FacadeTestCommand2.h"
+#import "FacadeTestVO.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation FacadeTestCommand2
+
+/**
+Fabricate a result by multiplying the input by 2, if the Core
+reached through `facade` has the proxy named by the notification type
+
+- parameter note: the Notification carrying the FacadeTestVO
+*/
+- (void)execute:(id<INotification>)notification {
+    FacadeTestVO *vo = notification.body;
+    
+    // Fabricate a result
+    vo.result = [self.facade hasProxy:notification.type] ? 2 * vo.input : 0;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
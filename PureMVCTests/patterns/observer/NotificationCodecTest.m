@@ -0,0 +1,103 @@
+//
+//  NotificationCodecTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+#import "NotificationCodecTestBodyCodec.h"
+
+@interface NotificationCodecTest : XCTestCase
+
+@end
+
+@implementation NotificationCodecTest
+
+/**
+Tests encoding and decoding with interned and inline names and types
+*/
+- (void)testRoundTrip {
+    NotificationCodec *codec = [NotificationCodec withNames:@[@"NotificationCodecTestNote", @"Type"] bodyCodec:nil];
+    NSData *body = [@"body" dataUsingEncoding:NSUTF8StringEncoding];
+    
+    for (id<INotification> notification in @[
+        [Notification withName:@"NotificationCodecTestNote" body:body type:@"Type"],
+        [Notification withName:@"NotificationCodecTestOtherNote" body:body type:@"OtherType"],
+        [Notification withName:@"NotificationCodecTestNote"]
+    ]) {
+        NSError *error = nil;
+        id<INotification> decoded = [codec decode:[codec encode:notification] error:&error];
+        
+        XCTAssertNotNil(decoded, @"Expecting decoded notification, %@", error);
+        XCTAssertEqualObjects(decoded.name, notification.name, @"Expecting the encoded name");
+        XCTAssertEqualObjects(decoded.type, notification.type, @"Expecting the encoded type");
+        XCTAssertEqualObjects(decoded.body, notification.body, @"Expecting the encoded body");
+    }
+}
+
+/**
+Tests that interned names and types are encoded as IDs
+*/
+- (void)testInterning {
+    id<INotification> notification = [Notification withName:@"NotificationCodecTestNote" body:nil type:@"Type"];
+    NSData *interned = [[NotificationCodec withNames:@[@"NotificationCodecTestNote", @"Type"] bodyCodec:nil] encode:notification];
+    NSData *uninterned = [[NotificationCodec codec] encode:notification];
+    
+    XCTAssertEqual(interned.length, (NSUInteger)12, @"Expecting a 4 byte header and two 4 byte IDs");
+    XCTAssertTrue(uninterned.length > interned.length, @"Expecting inline strings to be longer");
+}
+
+/**
+Tests that a decoded body is a slice of the decoded buffer
+*/
+- (void)testZeroCopyDecode {
+    NotificationCodec *codec = [NotificationCodec codec];
+    NSData *encoded = [codec encode:[Notification withName:@"NotificationCodecTestNote" body:[NSMutableData dataWithLength:256]]];
+    
+    NSData *body = [codec decode:encoded error:nil].body;
+    XCTAssertEqual(body.length, (NSUInteger)256, @"Expecting the body length");
+    XCTAssertTrue((const uint8_t *)body.bytes >= (const uint8_t *)encoded.bytes && (const uint8_t *)body.bytes + body.length <= (const uint8_t *)encoded.bytes + encoded.length, @"Expecting the body inside the encoded buffer");
+    
+    dispatch_data_t data = dispatch_data_create(encoded.bytes, encoded.length, nil, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+    id<INotification> decoded = [codec decodeDispatchData:data error:nil];
+    XCTAssertEqualObjects(decoded.name, @"NotificationCodecTestNote", @"Expecting the encoded name");
+    XCTAssertEqual([decoded.body length], (NSUInteger)256, @"Expecting the body length");
+}
+
+/**
+Tests bodies going through the body codec
+*/
+- (void)testBodyCodec {
+    NotificationCodec *codec = [NotificationCodec withNames:@[] bodyCodec:[[NotificationCodecTestBodyCodec alloc] init]];
+    id<INotification> decoded = [codec decode:[codec encode:[Notification withName:@"NotificationCodecTestNote" body:@"string"]] error:nil];
+    XCTAssertEqualObjects(decoded.body, @"string", @"Expecting the string body");
+    
+    XCTAssertThrowsSpecificNamed([codec encode:[Notification withName:@"NotificationCodecTestNote" body:@42]], NSException, @"NotificationCodecException", @"Expecting NotificationCodecException");
+    XCTAssertThrowsSpecificNamed([[NotificationCodec codec] encode:[Notification withName:@"NotificationCodecTestNote" body:@"string"]], NSException, @"NotificationCodecException", @"Expecting NotificationCodecException");
+}
+
+/**
+Tests that malformed bytes fail to decode with an error
+*/
+- (void)testDecodeErrors {
+    NotificationCodec *codec = [NotificationCodec withNames:@[@"NotificationCodecTestNote"] bodyCodec:nil];
+    NSData *encoded = [codec encode:[Notification withName:@"NotificationCodecTestOtherNote" body:[NSMutableData dataWithLength:16] type:@"Type"]];
+    
+    for (NSUInteger length = 0; length < encoded.length; length++) {
+        NSError *error = nil;
+        XCTAssertNil([codec decode:[encoded subdataWithRange:NSMakeRange(0, length)] error:&error], @"Expecting truncated bytes to fail");
+        XCTAssertEqualObjects(error.domain, @"org.puremvc.codec", @"Expecting a codec error");
+    }
+    
+    NSMutableData *version = [encoded mutableCopy];
+    ((uint8_t *)version.mutableBytes)[0] = [NotificationCodec VERSION] + 1;
+    XCTAssertNil([codec decode:version error:nil], @"Expecting an unsupported version to fail");
+    
+    NSData *interned = [codec encode:[Notification withName:@"NotificationCodecTestNote"]];
+    XCTAssertNil([[NotificationCodec codec] decode:interned error:nil], @"Expecting an unknown ID to fail");
+}
+
+@end
@@ -0,0 +1,28 @@
+//
+//  NotificationCodecTestBodyCodec.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef NotificationCodecTestBodyCodec_h
+#define NotificationCodecTestBodyCodec_h
+
+#import <Foundation/Foundation.h>
+#import <PureMVC/PureMVC.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+A body codec for string bodies, used by NotificationCodecTest.
+
+`@see NotificationCodecTest`
+*/
+@interface NotificationCodecTestBodyCodec : NSObject <IBodyCodec>
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NotificationCodecTestBodyCodec_h */
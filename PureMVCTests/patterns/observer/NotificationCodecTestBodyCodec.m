@@ -0,0 +1,26 @@
+//
+//  NotificationCodecTestBodyCodec.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import "NotificationCodecTestBodyCodec.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation NotificationCodecTestBodyCodec
+
+- (nullable NSData *)encodeBody:(id)body {
+    if (![body isKindOfClass:[NSString class]]) return nil;
+    return [(NSString *)body dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (nullable id)decodeBody:(NSData *)data {
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
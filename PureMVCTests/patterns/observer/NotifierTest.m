@@ -7,6 +7,7 @@
 //
 
 #import <XCTest/XCTest.h>
+#import <objc/runtime.h>
 #import <PureMVC/PureMVC.h>
 #import "NotifierTestCommand.h"
 #import "NotifierTestVO.h"
@@ -40,4 +41,102 @@ Tests notifier methods.
     XCTAssertTrue(vo.result == 64, @"Expecting vo.result == 24");
 }
 
+/**
+Tests that the facade of an existing Core is resolved once, by
+initializeNotifier, and not looked up again on access.
+*/
+- (void)testFacadeIsCached {
+    id<IFacade> facade = [Facade getInstance:@"NotifierTestKey3" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    Notifier *notifier = [[Notifier alloc] init];
+    [notifier initializeNotifier:@"NotifierTestKey3"];
+    
+    // count lookups through the registry while the notifier is used
+    Method method = class_getClassMethod([Facade class], @selector(getInstance:factory:));
+    IMP original = method_getImplementation(method);
+    __block NSUInteger lookups = 0;
+    method_setImplementation(method, imp_implementationWithBlock(^id<IFacade>(Class cls, NSString *key, id<IFacade> (^factory)(NSString *)) {
+        lookups++;
+        return ((id<IFacade> (*)(Class, SEL, NSString *, id<IFacade> (^)(NSString *)))original)(cls, @selector(getInstance:factory:), key, factory);
+    }));
+    
+    id<IFacade> cached = [notifier facade];
+    for (int i = 0; i < 100; i++) {
+        [notifier facade];
+    }
+    
+    method_setImplementation(method, original);
+    
+    XCTAssertTrue(cached == facade, @"Expecting the registered facade instance");
+    XCTAssertTrue(lookups == 0, @"Expecting lookups == 0");
+    
+    [Facade removeCore:@"NotifierTestKey3"];
+}
+
+/**
+Tests that removing another Core leaves the cached facade in place.
+*/
+- (void)testFacadeCachedAcrossOtherCoreRemoval {
+    id<IFacade> facade = [Facade getInstance:@"NotifierTestKey6" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    Notifier *notifier = [[Notifier alloc] init];
+    [notifier initializeNotifier:@"NotifierTestKey6"];
+    
+    [Facade getInstance:@"NotifierTestKey7" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    [Facade removeCore:@"NotifierTestKey7"];
+    
+    XCTAssertFalse(((Facade *)facade).isRemoved, @"Expecting the facade not removed");
+    XCTAssertTrue([notifier facade] == facade, @"Expecting the same facade instance");
+    
+    [Facade removeCore:@"NotifierTestKey6"];
+    
+    XCTAssertTrue(((Facade *)facade).isRemoved, @"Expecting the facade removed");
+    XCTAssertFalse([Facade hasCore:@"NotifierTestKey7"], @"Expecting no Core for NotifierTestKey7");
+}
+
+/**
+Tests that a removed and recreated Core is picked up by the cached facade.
+*/
+- (void)testFacadeAfterRemoveCore {
+    id<IFacade> facade = [Facade getInstance:@"NotifierTestKey4" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    Notifier *notifier = [[Notifier alloc] init];
+    [notifier initializeNotifier:@"NotifierTestKey4"];
+    
+    XCTAssertTrue([notifier facade] == facade, @"Expecting the cached facade instance");
+    [Facade removeCore:@"NotifierTestKey4"];
+    
+    id<IFacade> recreated = [Facade getInstance:@"NotifierTestKey4" factory:^(NSString *key) { return [Facade withKey:key]; }];
+    
+    XCTAssertTrue([notifier facade] == recreated, @"Expecting the recreated facade instance");
+    XCTAssertFalse([notifier facade] == facade, @"Expecting the removed facade not to be returned");
+    
+    [Facade removeCore:@"NotifierTestKey4"];
+}
+
+/**
+Tests that initializing a notifier never creates the Core.
+*/
+- (void)testInitializeNotifierDoesNotCreateCore {
+    Notifier *notifier = [[Notifier alloc] init];
+    [notifier initializeNotifier:@"NotifierTestKey8"];
+    
+    XCTAssertFalse([Facade hasCore:@"NotifierTestKey8"], @"Expecting no Core for NotifierTestKey8");
+    XCTAssertNil([Facade facadeForKey:@"NotifierTestKey8"], @"Expecting no Facade for NotifierTestKey8");
+}
+
+/**
+Tests sending a notification through the notifier itself.
+*/
+- (void)testSendNotification {
+    Notifier *notifier = [[Notifier alloc] init];
+    [notifier initializeNotifier:@"NotifierTestKey5"];
+    
+    [[notifier facade] registerCommand:@"NotifierTestNote" factory:^id<ICommand> { return [NotifierTestCommand command]; }];
+    
+    NotifierTestVO *vo = [[NotifierTestVO alloc] initWithInput:16];
+    [notifier sendNotification:@"NotifierTestNote" body:vo];
+    
+    XCTAssertTrue(vo.result == 32, @"Expecting vo.result == 32");
+    
+    [Facade removeCore:@"NotifierTestKey5"];
+}
+
 @end
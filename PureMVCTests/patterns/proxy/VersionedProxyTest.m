@@ -0,0 +1,87 @@
+//
+//  VersionedProxyTest.m
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#import <XCTest/XCTest.h>
+#import <PureMVC/PureMVC.h>
+
+@interface VersionedProxyTest : XCTestCase
+
+@end
+
+@implementation VersionedProxyTest
+
+/**
+Tests that each assignment of data publishes a new version.
+*/
+- (void)testDataAndVersion {
+    // Create a VersionedProxy with initial data
+    VersionedProxy *proxy = [VersionedProxy withName:@"colors" data:@[@"red"]];
+    XCTAssertEqual(proxy.version, 0, @"Expecting proxy.version == 0");
+    XCTAssertEqualObjects(proxy.data, @[@"red"], @"Expecting proxy.data == ['red']");
+    
+    // Publish new data
+    proxy.data = @[@"red", @"green"];
+    uint64_t version = 0;
+    NSArray *data = [proxy dataWithVersion:&version];
+    
+    // Test assertions
+    XCTAssertEqual(version, 1, @"Expecting version == 1");
+    XCTAssertEqual(proxy.version, 1, @"Expecting proxy.version == 1");
+    XCTAssertEqual(data.count, 2, @"Expecting data.count == 2");
+}
+
+/**
+Tests that concurrent updates are applied one after another.
+*/
+- (void)testConcurrentUpdates {
+    VersionedProxy *proxy = [VersionedProxy withName:@"counter" data:@(0)];
+    
+    dispatch_apply(1000, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t index) {
+        [proxy updateData:^id (NSNumber *count) { return @(count.integerValue + 1); }];
+    });
+    
+    XCTAssertEqualObjects(proxy.data, @(1000), @"Expecting proxy.data == 1000");
+    XCTAssertEqual(proxy.version, 1000, @"Expecting proxy.version == 1000");
+}
+
+/**
+Tests that readers always see a complete version while a writer publishes.
+*/
+- (void)testReadersSeeConsistentVersions {
+    VersionedProxy *proxy = [VersionedProxy withName:@"pair" data:@[@(0), @(0)]];
+    __block int32_t inconsistent = 0;
+    __block int32_t done = 0;
+    
+    // One writer publishes pairs of equal values
+    dispatch_group_t group = dispatch_group_create();
+    dispatch_group_async(group, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+        for (NSInteger i = 1; i <= 10000; i++) {
+            proxy.data = @[@(i), @(i)];
+        }
+        __atomic_store_n(&done, 1, __ATOMIC_SEQ_CST);
+    });
+    
+    // Many readers check each pinned pair, and that versions never go backwards
+    dispatch_apply(8, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t index) {
+        uint64_t last = 0;
+        while (__atomic_load_n(&done, __ATOMIC_SEQ_CST) == 0) {
+            uint64_t version = 0;
+            NSArray<NSNumber *> *pair = [proxy dataWithVersion:&version];
+            if (![pair[0] isEqual:pair[1]] || (uint64_t)pair[0].integerValue != version || version < last) {
+                __atomic_fetch_add(&inconsistent, 1, __ATOMIC_SEQ_CST);
+            }
+            last = version;
+        }
+    });
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    
+    XCTAssertEqual(inconsistent, 0, @"Expecting inconsistent == 0");
+    XCTAssertEqual(proxy.version, 10000, @"Expecting proxy.version == 10000");
+}
+
+@end
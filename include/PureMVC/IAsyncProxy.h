@@ -0,0 +1,56 @@
+//
+//  IAsyncProxy.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef IAsyncProxy_h
+#define IAsyncProxy_h
+
+#import <Foundation/Foundation.h>
+#import "IProxy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The loading state of a registered `IProxy`.
+typedef NS_ENUM(NSInteger, ProxyReadiness) {
+    /// Not registered, not an `IAsyncProxy`, or finished loading successfully.
+    ProxyReadinessReady = 0,
+    /// An `IAsyncProxy` whose load has not completed yet.
+    ProxyReadinessLoading,
+    /// An `IAsyncProxy` whose load completed with an error.
+    ProxyReadinessFailed
+};
+
+/**
+The interface definition for a PureMVC Proxy that loads its data asynchronously.
+
+When an `IAsyncProxy` is registered, the `Model` calls `onRegister`
+and returns right away, then calls `loadWithCompletion:` on its
+background load queue. Proxies registered together therefore load
+concurrently instead of one after another on the registering thread.
+
+The `Model` tracks each Proxy's `ProxyReadiness`, and sends
+`Model.PROXY_READY` (or `Model.PROXY_FAILED`) once loading completes.
+
+`@see Model`
+*/
+@protocol IAsyncProxy <IProxy>
+
+/**
+Load the Proxy's data.
+
+Called on the `Model`'s load queue after `onRegister`. The Proxy may
+hop to other queues while loading, but must call `completion` exactly once.
+
+- parameter completion: call with nil on success, or the error that prevented loading
+*/
+- (void)loadWithCompletion:(void (^)(NSError * _Nullable error))completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* IAsyncProxy_h */
@@ -0,0 +1,48 @@
+//
+//  IBodyCodec.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef IBodyCodec_h
+#define IBodyCodec_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+The interface definition for encoding `INotification` bodies to bytes.
+
+A `NotificationCodec` hands every body that is not `NSData` to its
+`IBodyCodec`. Decoded bytes may be a slice of the buffer being
+decoded, so a body codec should not assume they outlive the body it
+returns unless it retains them.
+
+`@see NotificationCodec`
+*/
+@protocol IBodyCodec <NSObject>
+
+/**
+Encode a body.
+
+@param body The body of an `INotification`.
+@return The encoded bytes, or nil if this codec does not handle the body.
+*/
+- (nullable NSData *)encodeBody:(id)body;
+
+/**
+Decode a body.
+
+@param data The encoded bytes.
+@return The decoded body, or nil if the bytes are not valid.
+*/
+- (nullable id)decodeBody:(NSData *)data;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* IBodyCodec_h */
@@ -65,6 +65,18 @@ Remove a previously registered `ICommand` to `INotification` mapping.
 */
 - (void)removeCommand:(NSString *)notificationName;
 
+/**
+Take a snapshot of the `Controller`'s command mappings, for diagnostics.
+
+The command map is read as a reader, so commands keep executing
+meanwhile. The result is JSON-compatible:
+
+    { "key": multitonKey, "commands": [ notificationName ] }
+
+- returns: the command mappings, serializable with `NSJSONSerialization`
+*/
+- (NSDictionary<NSString *, id> *)introspect;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -15,6 +15,8 @@
 #import "IProxy.h"
 #import "IMediator.h"
 #import "INotification.h"
+#import "IHandle.h"
+#import "IAsyncProxy.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -71,6 +73,14 @@ Register an `IProxy` with the `Model` by name.
 */
 - (void)registerProxy:(id<IProxy>)proxy;
 
+/**
+Register a factory that lazily creates an `IProxy` with the `Model`.
+
+- parameter factory: closure that returns the `IProxy` instance
+- parameter proxyName: the name the `IProxy` will be registered under
+*/
+- (void)registerProxyFactory:(id<IProxy> (^)(void))factory name:(NSString *)proxyName;
+
 /**
 Retrieve a `IProxy` from the `Model` by name.
 
@@ -79,6 +89,14 @@ Retrieve a `IProxy` from the `Model` by name.
 */
 - (nullable id<IProxy>)retrieveProxy:(NSString *)proxyName;
 
+/**
+Retrieve a handle that tracks the `IProxy` registered under a name.
+
+- parameter proxyName: the name of the `IProxy` to track
+- returns: the handle whose `target` is the currently registered `IProxy`.
+*/
+- (id<IHandle>)retrieveProxyHandle:(NSString *)proxyName;
+
 /**
 Check if a Proxy is registered
 
@@ -95,6 +113,22 @@ Remove an `IProxy` instance from the `Model` by name.
 */
 - (nullable id<IProxy>)removeProxy:(NSString *)proxyName;
 
+/**
+Get the loading state of an `IProxy` in the `Model`.
+
+- parameter proxyName: the name of the `IProxy`
+- returns: the `ProxyReadiness` of the `IProxy`
+*/
+- (ProxyReadiness)proxyReadiness:(NSString *)proxyName;
+
+/**
+Wait, without blocking, for a set of proxies in the `Model` to finish loading.
+
+- parameter proxyNames: the names of the proxies to wait for
+- parameter completion: called once all of them have finished loading
+*/
+- (void)awaitProxies:(NSArray<NSString *> *)proxyNames completion:(void (^)(void))completion;
+
 /**
 Register an `IMediator` instance with the `View`.
 
@@ -110,6 +144,14 @@ Retrieve an `IMediator` instance from the `View`.
 */
 - (nullable id<IMediator>)retrieveMediator:(NSString *)mediatorName;
 
+/**
+Retrieve a handle that tracks the `IMediator` registered under a name.
+
+- parameter mediatorName: the name of the `IMediator` to track
+- returns: the handle whose `target` is the currently registered `IMediator`.
+*/
+- (id<IHandle>)retrieveMediatorHandle:(NSString *)mediatorName;
+
 /**
 Check if a Mediator is registered or not
 
@@ -141,6 +183,18 @@ construct the notification yourself.
 */
 - (void)notifyObservers:(id<INotification>)notification;
 
+/**
+Take a snapshot of the Core's registrations, for diagnostics.
+
+Combines the `introspect` snapshots of the `Model`, `View`
+and `Controller`, each read without pausing senders:
+
+    { "key": multitonKey, "model": {...}, "view": {...}, "controller": {...} }
+
+- returns: the registrations, serializable with `NSJSONSerialization`
+*/
+- (NSDictionary<NSString *, id> *)introspect;
+
 /**
 Send a `INotification`.
 
@@ -0,0 +1,42 @@
+//
+//  IHandle.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef IHandle_h
+#define IHandle_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+The interface definition for a PureMVC Handle.
+
+An `IHandle` is resolved once by name from an `IModel` or `IView`
+and then tracks whichever `IProxy` or `IMediator` is registered
+under that name. Reading `target` is a single atomic load,
+avoiding the named lookup on every access in hot code paths.
+
+A handle sees the new instance when its registrant is removed
+and registered again, and nil while nothing is registered.
+
+`@see IModel`
+`@see IView`
+*/
+@protocol IHandle
+
+/// The name this handle was resolved by.
+@property (nonatomic, copy, readonly) NSString *name;
+
+/// The current registrant, or nil if nothing is registered under `name`.
+@property (atomic, strong, readonly, nullable) id target;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* IHandle_h */
@@ -0,0 +1,47 @@
+//
+//  IMapLock.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef IMapLock_h
+#define IMapLock_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+The interface definition for the synchronization of a map.
+
+The `View` guards its `observerMap` and `mediatorMap`, the
+`Controller` its `commandMap` and the `Model` its `proxyMap` each
+with an `IMapLock`. Reads may run concurrently with one another,
+a write runs alone. Neither is reentrant: a block must not read
+or write through the same lock again.
+
+`@see MapLock`
+*/
+@protocol IMapLock <NSObject>
+
+/**
+Run a block that only reads the guarded map.
+
+- parameter block: the read, run before this method returns
+*/
+- (void)read:(NS_NOESCAPE dispatch_block_t)block;
+
+/**
+Run a block that may modify the guarded map.
+
+- parameter block: the write, run before this method returns
+*/
+- (void)write:(NS_NOESCAPE dispatch_block_t)block;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* IMapLock_h */
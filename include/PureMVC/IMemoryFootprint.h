@@ -0,0 +1,41 @@
+//
+//  IMemoryFootprint.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef IMemoryFootprint_h
+#define IMemoryFootprint_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+The interface definition for an object that reports its memory usage.
+
+`IProxy` implementors adopt `IMemoryFootprint` to take part in
+the `Model`'s memory budget. A Proxy that reports its footprint
+and was registered with a factory may be evicted by the `Model`
+when the budget is exceeded, and is recreated by its factory the
+next time it is retrieved.
+
+Registered proxies and mediators that adopt `IMemoryFootprint`
+also report their payload to their Core's `MemoryAccount`.
+
+`@see Model`
+
+`@see MemoryAccount`
+*/
+@protocol IMemoryFootprint
+
+/// The approximate number of bytes held by this object and its data.
+@property (nonatomic, readonly) NSUInteger memoryFootprint;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* IMemoryFootprint_h */
@@ -11,6 +11,8 @@
 
 #import <Foundation/Foundation.h>
 #import "IProxy.h"
+#import "IHandle.h"
+#import "IAsyncProxy.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -34,6 +36,19 @@ Register an `IProxy` instance with the `Model`.
 */
 - (void)registerProxy:(id<IProxy>)proxy;
 
+/**
+Register a factory that lazily creates an `IProxy` with the `Model`.
+
+The factory is not invoked until the first time `proxyName`
+is retrieved, at which point the `IProxy` is created,
+registered and has its `onRegister` method called.
+Concurrent first retrievals invoke the factory only once.
+
+- parameter factory: closure that returns the `IProxy` instance
+- parameter proxyName: the name the `IProxy` will be registered under
+*/
+- (void)registerProxyFactory:(id<IProxy> (^)(void))factory name:(NSString *)proxyName;
+
 /**
 Retrieve an `IProxy` instance from the Model.
 
@@ -42,11 +57,23 @@ Retrieve an `IProxy` instance from the Model.
 */
 - (nullable id<IProxy>)retrieveProxy:(NSString *)proxyName;
 
+/**
+Retrieve a handle that tracks the `IProxy` registered under a name.
+
+The handle's `target` is the currently registered `IProxy`,
+read with a single atomic load, or nil after it is removed.
+A factory registered `IProxy` is created on first access.
+
+- parameter proxyName: the name of the `IProxy` to track
+- returns: the handle for `proxyName`, the same instance on every call.
+*/
+- (id<IHandle>)retrieveProxyHandle:(NSString *)proxyName;
+
 /**
 Check if a Proxy is registered
 
 - parameter proxyName:
-- returns: whether a Proxy is currently registered with the given `proxyName`.
+- returns: whether a Proxy or Proxy factory is currently registered with the given `proxyName`.
 */
 - (BOOL)hasProxy:(NSString *)proxyName;
 
@@ -58,6 +85,41 @@ Remove an `IProxy` instance from the Model.
 */
 - (nullable id<IProxy>)removeProxy:(NSString *)proxyName;
 
+/**
+Get the loading state of an `IProxy`.
+
+- parameter proxyName: the name of the `IProxy`
+- returns: `ProxyReadinessLoading` while an `IAsyncProxy` is loading, `ProxyReadinessFailed` if its load failed, otherwise `ProxyReadinessReady`.
+*/
+- (ProxyReadiness)proxyReadiness:(NSString *)proxyName;
+
+/**
+Wait, without blocking, for a set of proxies to finish loading.
+
+Factory registered proxies are created first, which starts their load.
+The completion runs on the `Model`'s load queue once every named
+Proxy has finished loading, successfully or not.
+
+- parameter proxyNames: the names of the proxies to wait for
+- parameter completion: called once all of them have finished loading
+*/
+- (void)awaitProxies:(NSArray<NSString *> *)proxyNames completion:(void (^)(void))completion;
+
+/**
+Take a snapshot of the `Model`'s registrations, for diagnostics.
+
+The proxy maps are read together, as a reader, so proxies keep
+being retrieved meanwhile. The result is JSON-compatible:
+
+    { "key": multitonKey,
+      "proxies": [ { "name": name, "class": name, "readiness": "ready" | "loading" | "failed" } ],
+      "factories": [ name of a factory registered Proxy not created yet ],
+      "snapshots": [ name of snapshot data not restored yet ] }
+
+- returns: the registrations, serializable with `NSJSONSerialization`
+*/
+- (NSDictionary<NSString *, id> *)introspect;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,53 @@
+//
+//  ISnapshotProxy.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef ISnapshotProxy_h
+#define ISnapshotProxy_h
+
+#import <Foundation/Foundation.h>
+#import "IProxy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+The interface definition for a PureMVC Proxy that can be snapshotted.
+
+`IProxy` implementors adopt `ISnapshotProxy` to have their data
+written to a `Model` snapshot file, and restored from it on the
+next start instead of being fetched or parsed again.
+
+When a snapshot has been loaded, the `Model` calls
+`restoreSnapshotData:` right before `onRegister`, so the Proxy
+can skip loading its data when it has already been restored.
+
+`@see Model`
+*/
+@protocol ISnapshotProxy <IProxy>
+
+/**
+Encode the Proxy's data for a snapshot.
+
+- returns: the encoded data, or nil to leave this Proxy out of the snapshot.
+*/
+- (nullable NSData *)snapshotData;
+
+/**
+Restore the Proxy's data from a snapshot.
+
+The bytes are memory-mapped from the snapshot file and are
+read-only; decode lazily from them rather than copying where possible.
+
+- parameter data: the data previously returned by `snapshotData`
+*/
+- (void)restoreSnapshotData:(NSData *)data;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* ISnapshotProxy_h */
@@ -12,6 +12,7 @@
 #import <Foundation/Foundation.h>
 #import "IObserver.h"
 #import "IMediator.h"
+#import "IHandle.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -90,6 +91,17 @@ Retrieve an `IMediator` from the `View`.
 */
 - (nullable id<IMediator>)retrieveMediator:(NSString *)mediatorName;
 
+/**
+Retrieve a handle that tracks the `IMediator` registered under a name.
+
+The handle's `target` is the currently registered `IMediator`,
+read with a single atomic load, or nil after it is removed.
+
+- parameter mediatorName: the name of the `IMediator` to track
+- returns: the handle for `mediatorName`, the same instance on every call.
+*/
+- (id<IHandle>)retrieveMediatorHandle:(NSString *)mediatorName;
+
 /**
 Check if a Mediator is registered or not
 
@@ -106,6 +118,24 @@ Remove an `IMediator` from the `View`.
 */
 - (nullable id<IMediator>)removeMediator:(NSString *)mediatorName;
 
+/**
+Take a snapshot of the `View`'s registrations, for diagnostics.
+
+The observer and mediator maps are read together, as a reader,
+so notifications keep being sent meanwhile. The result is
+JSON-compatible:
+
+    { "key": multitonKey,
+      "notifications": { name: { "observers": count, "live": count,
+                                 "contexts": [ { "class": name or null, "alive": bool } ] } },
+      "mediators": [ { "name": name, "class": name } ] }
+
+An observer whose context is no longer alive is a leaked registration.
+
+- returns: the registrations, serializable with `NSJSONSerialization`
+*/
+- (NSDictionary<NSString *, id> *)introspect;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -19,6 +19,12 @@
 #include "INotifier.h"
 #include "IObserver.h"
 #include "IProxy.h"
+#include "IMemoryFootprint.h"
+#include "ISnapshotProxy.h"
+#include "IHandle.h"
+#include "IAsyncProxy.h"
+#include "IBodyCodec.h"
+#include "IMapLock.h"
 
 #include "base/Controller.h"
 #include "base/Model.h"
@@ -31,5 +37,22 @@
 #include "base/Notifier.h"
 #include "base/Observer.h"
 #include "base/Proxy.h"
+#include "base/VersionedProxy.h"
+#include "base/VersionedReference.h"
+#include "base/MultitonRegistry.h"
+#include "base/Handle.h"
+#include "base/CoreTemplate.h"
+#include "base/Pipe.h"
+#include "base/Bus.h"
+#include "base/SharedMemoryTransport.h"
+#include "base/NotificationCodec.h"
+#include "base/LatencyHistogram.h"
+#include "base/Instrumentation.h"
+#include "base/Tracer.h"
+#include "base/FlightRecorder.h"
+#include "base/MemoryAccount.h"
+#include "base/Watchdog.h"
+#include "base/Confinement.h"
+#include "base/MapLock.h"
 
 #endif /* PureMVC_h */
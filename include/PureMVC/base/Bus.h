@@ -0,0 +1,79 @@
+//
+//  Bus.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Bus_h
+#define Bus_h
+
+#import <Foundation/Foundation.h>
+#import "INotification.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A process-wide, topic-routed broadcast bus between Cores.
+
+ Cores subscribe to topics by multiton key. Publishing looks up the
+ subscribers in a precomputed topic index without taking a lock and
+ writes the notification into each subscriber's `Pipe`, so every
+ Core handles it on its own executor, in parallel with the others.
+
+ The same notification instance is delivered to every subscriber,
+ which must treat it as immutable.
+
+ A Core is unsubscribed from every topic by `Facade.removeCore:`.
+
+ @see Pipe
+ */
+@interface Bus : NSObject
+
+/**
+ Subscribe a Core to a topic.
+
+ @param key The multiton key of the Core.
+ @param topic The topic to subscribe to.
+ */
++ (void)subscribe:(NSString *)key topic:(NSString *)topic;
+
+/**
+ Unsubscribe a Core from a topic.
+
+ @param key The multiton key of the Core.
+ @param topic The topic to unsubscribe from.
+ */
++ (void)unsubscribe:(NSString *)key topic:(NSString *)topic;
+
+/**
+ Unsubscribe a Core from every topic.
+
+ @param key The multiton key of the Core.
+ */
++ (void)unsubscribeCore:(NSString *)key;
+
+/**
+ Check whether a Core is subscribed to a topic.
+
+ @param key The multiton key of the Core.
+ @param topic The topic.
+ @return YES if the Core is subscribed to the topic.
+ */
++ (BOOL)isSubscribed:(NSString *)key topic:(NSString *)topic;
+
+/**
+ Deliver a notification to every Core subscribed to a topic.
+
+ @param notification The notification, shared by all subscribers.
+ @param topic The topic to publish to.
+ @return The number of Cores the notification was written to; a Core whose pipe is full is skipped.
+ */
++ (NSUInteger)publish:(id<INotification>)notification topic:(NSString *)topic;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Bus_h */
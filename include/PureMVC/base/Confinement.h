@@ -0,0 +1,80 @@
+//
+//  Confinement.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Confinement_h
+#define Confinement_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The confinement of a Core to the thread that created it.
+
+ The `View`, `Model` and `Controller` of a confined Core guard their
+ maps with `MapLockStrategyConfined` locks, which access the maps
+ directly rather than through a dispatch queue or lock. Every access
+ must then come from the owning thread; builds with assertions enabled
+ check it on each access.
+
+ A Core is confined by calling `confineCore:` before its actors are
+ created, most simply through `Facade.confinedWithKey:`, and is
+ released from confinement by `Facade.removeCore:`. Work a confined
+ Core would receive from other threads, such as `IAsyncProxy` loads,
+ `Pipe` and `Bus` deliveries, must not be used with it.
+
+ @see Facade
+ @see MapLock
+ */
+@interface Confinement : NSObject
+
+/// The multiton key of the confined Core.
+@property (nonatomic, copy, readonly) NSString *multitonKey;
+
+/// Whether the calling thread is the one the Core is confined to.
+@property (nonatomic, readonly, getter=isOwnerThread) BOOL ownerThread;
+
+/**
+ Confine a Core to the calling thread.
+
+ Actors of the Core created afterwards are confined; actors already
+ created are not.
+
+ @param key The multiton key of the Core.
+ @return The Core's confinement, the existing one if it is already confined.
+ */
++ (Confinement *)confineCore:(NSString *)key;
+
+/**
+ The confinement of a Core, if it is confined.
+
+ @param key The multiton key of the Core.
+ @return The Core's confinement, or nil when it is shared between threads.
+ */
++ (nullable Confinement *)confinementForKey:(NSString *)key;
+
+/**
+ Release a Core from confinement, for the actors created afterwards.
+
+ @param key The multiton key of the Core.
+ */
++ (void)removeConfinement:(NSString *)key;
+
+/**
+ Create a confinement to the calling thread, not registered for any Core.
+
+ @param key The multiton key of the Core, or a label.
+ @return A new confinement.
+ */
+- (instancetype)initWithKey:(NSString *)key;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Confinement_h */
@@ -26,7 +26,7 @@ NS_ASSUME_NONNULL_BEGIN
 + (id<IController>) getInstance:(NSString *)key factory:(id<IController> (^)(NSString *key))factory;
 
 /**
- * Removes the `Controller` instance associated with the given key.
+ * Removes the `Controller` instance associated with the given key, along with its `ICommand` mappings.
  *
  * @param key The multiton key of the `Controller` instance to remove.
  */
@@ -48,11 +48,35 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype) initWithKey:(NSString *)key;
 
+/**
+ * Initializes a new `Controller` instance with its `ICommand` mappings already in place.
+ *
+ * The mappings are installed without a barrier per command, and a
+ * single `IObserver` is registered with the `View` for all of them.
+ *
+ * @param key The multiton key.
+ * @param commands `ICommand` factories keyed by notification name, typically from `CoreTemplate`.
+ * @return An initialized `Controller` instance.
+ */
+- (instancetype) initWithKey:(NSString *)key commands:(NSDictionary<NSString *, id<ICommand> (^)(void)> *)commands;
+
+/**
+ * A snapshot of the `ICommand` factories, keyed by notification name.
+ */
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id<ICommand> (^)(void)> *commands;
+
 /**
  Initialize the `Controller` instance.
  */
 - (void)initializeController;
 
+/**
+ Remove every `ICommand` mapping from the `Controller` in a single barrier,
+ along with the `IObserver` each mapping registered with the `View`,
+ removed in a single barrier on its observer map.
+ */
+- (void)removeAllCommands;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,66 @@
+//
+//  CoreTemplate.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef CoreTemplate_h
+#define CoreTemplate_h
+
+#import <Foundation/Foundation.h>
+#import "IFacade.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ An immutable capture of an initialized Core, used to stamp out new Cores by key.
+
+ A template records the `ICommand` factories, Proxy factories and
+ `IMediator` instances registered with a Core. Cores created from it
+ share the command and Proxy factory maps instead of registering each
+ entry behind its own barrier, and register their mediators in bulk.
+
+ Registered `IProxy` and `IMediator` instances are captured by copy,
+ so they must adopt `NSCopying`. Proxies captured this way, like
+ factory registered ones, are created on their first retrieval in
+ each new Core.
+
+ @see Facade
+ */
+@interface CoreTemplate : NSObject
+
+/**
+ Factory method capturing the Core registered under a key.
+
+ @param key The multiton key of an initialized Core.
+ @return A new `CoreTemplate`.
+ @note Raises `CoreTemplateException` if the Core does not exist, does not
+ use the `Model`, `View` and `Controller` classes or their subclasses, or
+ holds an `IProxy` or `IMediator` that does not adopt `NSCopying`.
+ */
++ (instancetype)withKey:(NSString *)key;
+
+/**
+ Designated initializer capturing the Core registered under a key.
+
+ @param key The multiton key of an initialized Core.
+ @return An initialized `CoreTemplate`.
+ */
+- (instancetype)initWithKey:(NSString *)key;
+
+/**
+ Create and register a new Core from this template.
+
+ @param key The multiton key for the new Core.
+ @return The `IFacade` of the new Core.
+ @note Raises `CoreTemplateException` if a Core already exists for the key.
+ */
+- (id<IFacade>)instantiateWithKey:(NSString *)key;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* CoreTemplate_h */
@@ -11,6 +11,7 @@
 
 #import <Foundation/Foundation.h>
 #import "IFacade.h"
+#import "MapLock.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -34,12 +35,29 @@ NS_ASSUME_NONNULL_BEGIN
 + (BOOL)hasCore:(NSString *)key;
 
 /**
- * Removes the Core (Facade) instance and its associated Model, View, Controller for the given key.
+ * The Facade of a Core, if it has one; never creates it.
+ *
+ * @param key The multiton key.
+ * @return The `Facade` instance associated with the key, or nil.
+ */
++ (nullable id<IFacade>)facadeForKey:(NSString *)key;
+
+/**
+ * Removes the Core (Facade) instance and its associated Model, View, Controller and Pipe for the given key.
  *
  * @param key The multiton key of the Core to remove.
  */
 + (void)removeCore:(NSString *)key;
 
+/**
+ * Whether this Facade's Core has been removed with `removeCore:`.
+ *
+ * Holders of a cached `Facade` reference, such as `Notifier`,
+ * check it to detect that their own Core is gone, with a single
+ * atomic load; removing another Core leaves it unchanged.
+ */
+@property (nonatomic, readonly, getter=isRemoved) BOOL removed;
+
 /**
  * Convenience constructor creating a new Facade instance with the given key.
  *
@@ -48,6 +66,29 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (instancetype)withKey:(NSString *)key;
 
+/**
+ * Convenience constructor creating a Core confined to the calling thread.
+ *
+ * The Core's `Model`, `View` and `Controller` skip the queues guarding
+ * their maps, so it must only be used from the thread that created it.
+ *
+ * @param key The multiton key.
+ * @return A new instance of the receiving class, confined to the calling thread.
+ * @see Confinement
+ */
++ (instancetype)confinedWithKey:(NSString *)key;
+
+/**
+ * Convenience constructor creating a Core whose `Model`, `View` and
+ * `Controller` synchronize their maps with a given strategy.
+ *
+ * @param key The multiton key.
+ * @param strategy The `MapLockStrategy` of the Core's maps.
+ * @return A new instance of the receiving class.
+ * @see MapLock
+ */
++ (instancetype)withKey:(NSString *)key mapLockStrategy:(MapLockStrategy)strategy;
+
 /**
  * Initializes a new Facade instance with the given multiton key.
  *
@@ -0,0 +1,110 @@
+//
+//  FlightRecorder.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef FlightRecorder_h
+#define FlightRecorder_h
+
+#import <Foundation/Foundation.h>
+#import "INotification.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Write every live Core's flight recorder to a file descriptor.
+
+ Safe to call from a signal handler: it only reads the rings, formats
+ with its own code and writes with `write(2)`.
+
+ @param fd The file descriptor to write to.
+ */
+FOUNDATION_EXPORT void FlightRecorderDumpAll(int fd);
+
+/**
+ A fixed-size ring of the notifications a Core most recently sent.
+
+ Each `View` owns a `FlightRecorder`, and its `notifyObservers:`
+ records the timestamp, name, type, fanout and duration of every
+ notification while `FlightRecorder.enabled` is set, which it is by
+ default. Recording claims a slot with a single atomic increment and
+ never blocks; the oldest records are overwritten.
+
+ Names and types are copied into the ring, truncated to fit, so the
+ ring can be read without touching any object: `dumpToFileDescriptor:`
+ and `FlightRecorderDumpAll` are safe to call from a signal handler,
+ for example on a crash.
+
+ @see View
+ */
+@interface FlightRecorder : NSObject
+
+/// Whether Views record, on by default; always NO when `PUREMVC_INSTRUMENTATION` is 0.
+@property (class, nonatomic, getter=isEnabled) BOOL enabled;
+
+/// The number of records a new `View`'s recorder keeps, 256 by default, rounded up to a power of two.
+@property (class, nonatomic) NSUInteger defaultCapacity;
+
+/// The multiton key of the recorded Core.
+@property (nonatomic, copy, readonly) NSString *multitonKey;
+
+/// The number of records kept, a power of two.
+@property (nonatomic, readonly) NSUInteger capacity;
+
+/// The number of notifications recorded since creation, including overwritten ones.
+@property (nonatomic, readonly) uint64_t recordedCount;
+
+/**
+ The records still in the ring, oldest first.
+
+ Each record is a dictionary with `timestamp` and `duration` in
+ monotonic nanoseconds, `fanout`, `name`, and `type` when the
+ notification had one. Records being written while read are skipped.
+ */
+@property (nonatomic, copy, readonly) NSArray<NSDictionary<NSString *, id> *> *records;
+
+/**
+ Factory method to create a `FlightRecorder` for a Core.
+
+ @param key The multiton key of the Core.
+ @param capacity The number of records to keep, rounded up to a power of two.
+ @return A new `FlightRecorder` instance.
+ */
++ (instancetype)withKey:(NSString *)key capacity:(NSUInteger)capacity;
+
+/**
+ Designated initializer.
+
+ @param key The multiton key of the Core.
+ @param capacity The number of records to keep, rounded up to a power of two.
+ @return An initialized `FlightRecorder` instance.
+ */
+- (instancetype)initWithKey:(NSString *)key capacity:(NSUInteger)capacity;
+
+/**
+ Record one send of a notification.
+
+ @param notification The notification sent.
+ @param start When the send started, in monotonic nanoseconds.
+ @param duration How long the send took, in nanoseconds.
+ @param fanout The number of observers notified.
+ */
+- (void)recordNotification:(id<INotification>)notification start:(uint64_t)start duration:(uint64_t)duration fanout:(NSUInteger)fanout;
+
+/**
+ Write the records to a file descriptor, oldest first, one line each.
+
+ Safe to call from a signal handler.
+
+ @param fd The file descriptor to write to.
+ */
+- (void)dumpToFileDescriptor:(int)fd;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* FlightRecorder_h */
@@ -0,0 +1,64 @@
+//
+//  Handle.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Handle_h
+#define Handle_h
+
+#import <Foundation/Foundation.h>
+#import "IHandle.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A base `IHandle` implementation.
+
+ Handles are created and kept current by the `Model` and `View`;
+ you obtain one through `retrieveProxyHandle:` or `retrieveMediatorHandle:`
+ rather than constructing it yourself.
+
+ @see Model
+ @see View
+ */
+@interface Handle : NSObject <IHandle>
+
+/// The name this handle was resolved by.
+@property (nonatomic, copy, readonly) NSString *name;
+
+/**
+ Factory method to create a new `Handle`.
+
+ @param name The registrant name.
+ @param resolver Optional block called when `target` is nil, to resolve a lazily created registrant.
+ @return A new `Handle` instance.
+ */
++ (instancetype)withName:(NSString *)name resolver:(nullable id _Nullable (^)(NSString *name))resolver;
+
+/**
+ Designated initializer.
+
+ @param name The registrant name.
+ @param resolver Optional block called when `target` is nil, to resolve a lazily created registrant.
+ @return An initialized `Handle` instance.
+ */
+- (instancetype)initWithName:(NSString *)name resolver:(nullable id _Nullable (^)(NSString *name))resolver;
+
+/**
+ Point the handle at a new registrant.
+
+ Called by the owning `Model` or `View` whenever the registrant
+ for `name` is registered or removed.
+
+ @param target The current registrant, or nil.
+ */
+- (void)updateTarget:(nullable id)target;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Handle_h */
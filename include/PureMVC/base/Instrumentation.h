@@ -0,0 +1,155 @@
+//
+//  Instrumentation.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Instrumentation_h
+#define Instrumentation_h
+
+#import <Foundation/Foundation.h>
+#import <time.h>
+#import "LatencyHistogram.h"
+
+/**
+ Compiles the instrumentation hooks into `View`, `Controller` and `MacroCommand`.
+
+ Define as 0 when building the framework to remove the hooks entirely.
+ When compiled in, each hook only runs while its flag is set in
+ `InstrumentationFlags`; with every flag off, a dispatch costs one
+ relaxed atomic load. Only the flight recorder is on by default, and on
+ its own it adds two clock reads and a ring write to each notify.
+ */
+#ifndef PUREMVC_INSTRUMENTATION
+#define PUREMVC_INSTRUMENTATION 1
+#endif
+
+/// The hooks turned on in `InstrumentationFlags`.
+typedef NS_OPTIONS(unsigned, InstrumentationFlag) {
+    /// Latency histograms, `Instrumentation.enabled`.
+    InstrumentationFlagHistograms = 1 << 0,
+    /// Trace spans, `Tracer.enabled`.
+    InstrumentationFlagTrace = 1 << 1,
+    /// Per-Core flight recorder, `FlightRecorder.enabled`.
+    InstrumentationFlagFlightRecorder = 1 << 2,
+    /// Per-Core memory accounting, `MemoryAccount.enabled`.
+    InstrumentationFlagMemory = 1 << 3,
+    /// Per-Core latency budgets, `Watchdog.enabled`.
+    InstrumentationFlagWatchdog = 1 << 4,
+};
+
+#if PUREMVC_INSTRUMENTATION && !defined(__cplusplus)
+#include <stdatomic.h>
+
+/// The `InstrumentationFlag`s turned on, read on every dispatch.
+FOUNDATION_EXPORT atomic_uint InstrumentationFlags;
+
+/// The hooks turned on, a single relaxed load; 0 when all are off.
+static inline unsigned InstrumentationActiveFlags(void) {
+    return atomic_load_explicit(&InstrumentationFlags, memory_order_relaxed);
+}
+
+/// Turn a hook on or off.
+static inline void InstrumentationSetFlag(InstrumentationFlag flag, BOOL on) {
+    if (on) atomic_fetch_or_explicit(&InstrumentationFlags, flag, memory_order_relaxed);
+    else atomic_fetch_and_explicit(&InstrumentationFlags, ~(unsigned)flag, memory_order_relaxed);
+}
+
+#endif
+
+/// A monotonic timestamp in nanoseconds.
+static inline uint64_t InstrumentationNow(void) {
+#ifdef __APPLE__
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * NSEC_PER_SEC + (uint64_t)now.tv_nsec;
+#endif
+}
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Latency and fanout histograms of a Core's notification dispatch.
+
+ Each `View` owns an `Instrumentation`, which its `notifyObservers:`
+ and its `Controller`'s `executeCommand:` record into while
+ `Instrumentation.enabled` is set:
+
+ - `notificationLatencies`: the time spent in `notifyObservers:` per
+   notification name; its count is the number of sends.
+ - `notificationFanouts`: the number of observers notified per send,
+   per notification name.
+ - `observerLatencies`: the time spent in each observer per
+   notification, keyed by the class name of the observer's context.
+ - `commandLatencies`: the time spent in `executeCommand:` per
+   notification name.
+
+ Latencies are in nanoseconds. Recording is lock-free; a histogram is
+ created, once, the first time its key is recorded.
+
+ @see LatencyHistogram
+ @see View
+ */
+@interface Instrumentation : NSObject
+
+/// Whether the hooks record, off by default; always NO when compiled out.
+@property (class, nonatomic, getter=isEnabled) BOOL enabled;
+
+/// Snapshots of the `notifyObservers:` latencies, keyed by notification name.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, LatencyHistogram *> *notificationLatencies;
+
+/// Snapshots of the observers notified per send, keyed by notification name.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, LatencyHistogram *> *notificationFanouts;
+
+/// Snapshots of the per-observer latencies, keyed by the class name of the observer's context.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, LatencyHistogram *> *observerLatencies;
+
+/// Snapshots of the `executeCommand:` latencies, keyed by notification name.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, LatencyHistogram *> *commandLatencies;
+
+/**
+ Factory method to create an empty `Instrumentation`.
+
+ @return A new `Instrumentation` instance.
+ */
++ (instancetype)instrumentation;
+
+/**
+ Record one send of a notification.
+
+ @param notificationName The name of the notification.
+ @param latency The time spent notifying its observers, in nanoseconds.
+ @param fanout The number of observers notified.
+ */
+- (void)recordNotification:(NSString *)notificationName latency:(uint64_t)latency fanout:(NSUInteger)fanout;
+
+/**
+ Record one notification of an observer.
+
+ @param contextClass The class of the observer's context.
+ @param latency The time spent in the observer, in nanoseconds.
+ */
+- (void)recordObserver:(Class)contextClass latency:(uint64_t)latency;
+
+/**
+ Record one execution of a command.
+
+ @param notificationName The name of the notification that triggered the command.
+ @param latency The time spent executing the command, in nanoseconds.
+ */
+- (void)recordCommand:(NSString *)notificationName latency:(uint64_t)latency;
+
+/**
+ Clear every histogram.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Instrumentation_h */
@@ -0,0 +1,94 @@
+//
+//  LatencyHistogram.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef LatencyHistogram_h
+#define LatencyHistogram_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A lock-free histogram of non-negative integer values, typically
+ latencies in nanoseconds.
+
+ Values are counted in log-linear buckets in the style of an HDR
+ histogram: every power of two is split into 32 linear sub-buckets,
+ so a recorded value is reported within about 3% of its true value
+ from 1 up to 2^41. Larger values are counted in the last bucket.
+
+ `recordValue:` is wait-free apart from tracking the minimum and
+ maximum, and may be called from any number of threads. Readers see
+ each counter atomically but not the histogram as a whole; take a
+ `snapshot` for a consistent set of statistics.
+ */
+@interface LatencyHistogram : NSObject
+
+/// The number of recorded values.
+@property (nonatomic, readonly) uint64_t count;
+
+/// The sum of the recorded values.
+@property (nonatomic, readonly) uint64_t sum;
+
+/// The smallest recorded value, or 0 if none were recorded.
+@property (nonatomic, readonly) uint64_t min;
+
+/// The largest recorded value, or 0 if none were recorded.
+@property (nonatomic, readonly) uint64_t max;
+
+/// The mean of the recorded values, or 0 if none were recorded.
+@property (nonatomic, readonly) double mean;
+
+/**
+ Factory method to create an empty `LatencyHistogram`.
+
+ @return A new `LatencyHistogram` instance.
+ */
++ (instancetype)histogram;
+
+/**
+ Record a value.
+
+ @param value The value to count.
+ */
+- (void)recordValue:(uint64_t)value;
+
+/**
+ The value at or below which the given percentage of recorded values fall.
+
+ @param percentile The percentile, from 0 to 100.
+ @return The highest value equivalent to the bucket holding the percentile, or 0 if none were recorded.
+ */
+- (uint64_t)valueAtPercentile:(double)percentile;
+
+/**
+ Copy the current counts into a new histogram that no one records into.
+
+ @return A snapshot of this histogram.
+ */
+- (LatencyHistogram *)snapshot;
+
+/**
+ Add the counts of another histogram to this one.
+
+ @param histogram The histogram to add, for example one recorded by another thread.
+ */
+- (void)addHistogram:(LatencyHistogram *)histogram;
+
+/**
+ Clear all counts.
+
+ Values recorded concurrently with a reset may be partially kept.
+ */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* LatencyHistogram_h */
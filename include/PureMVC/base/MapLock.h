@@ -0,0 +1,95 @@
+//
+//  MapLock.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef MapLock_h
+#define MapLock_h
+
+#import <Foundation/Foundation.h>
+#import "IMapLock.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// How the maps of a Core are synchronized.
+typedef NS_ENUM(NSInteger, MapLockStrategy) {
+    /// A concurrent dispatch queue, reads with `dispatch_sync` and writes with `dispatch_barrier_sync`; the default.
+    MapLockStrategyDispatch,
+    /// A `pthread_rwlock_t`.
+    MapLockStrategyReadWrite,
+    /// A reader-writer spinlock in one atomic word, for short critical sections on otherwise idle cores.
+    MapLockStrategySpin,
+    /// Read-mostly, RCU style: readers only touch their own cache line, a writer waits for every reader to drain.
+    MapLockStrategyReadMostly,
+    /// No synchronization, for a Core confined to one thread, see `Confinement`.
+    MapLockStrategyConfined,
+};
+
+/**
+ The `IMapLock` implementations, and the strategy each Core uses.
+
+ A Core's strategy is chosen before its actors are created, with
+ `setStrategy:forCore:` or `Facade.withKey:mapLockStrategy:`, and each
+ actor creates its locks with `lockForCore:label:`. Cores without a
+ strategy use `MapLockStrategyDispatch`.
+
+ Which strategy is fastest depends on the mix of reads and writes
+ and on the number of threads; `pmvc-locks` in `Benchmarks/` compares
+ them.
+
+ @see IMapLock
+ @see Confinement
+ */
+@interface MapLock : NSObject
+
+/**
+ Choose the strategy of a Core, for the actors created afterwards.
+
+ Choosing `MapLockStrategyConfined` confines the Core to the calling thread.
+
+ @param strategy The strategy.
+ @param key The multiton key of the Core.
+ */
++ (void)setStrategy:(MapLockStrategy)strategy forCore:(NSString *)key;
+
+/**
+ The strategy of a Core.
+
+ @param key The multiton key of the Core.
+ @return The Core's strategy, `MapLockStrategyDispatch` unless another was chosen.
+ */
++ (MapLockStrategy)strategyForCore:(NSString *)key;
+
+/**
+ Forget the strategy of a Core, and release it from `Confinement`.
+
+ @param key The multiton key of the Core.
+ */
++ (void)removeStrategyForCore:(NSString *)key;
+
+/**
+ Create a lock with the strategy of a Core.
+
+ @param key The multiton key of the Core.
+ @param label A label for the lock, naming the dispatch queue when there is one.
+ @return A new lock.
+ */
++ (id<IMapLock>)lockForCore:(NSString *)key label:(NSString *)label;
+
+/**
+ Create a lock with a strategy.
+
+ @param strategy The strategy; `MapLockStrategyConfined` confines to the calling thread.
+ @param label A label for the lock, naming the dispatch queue when there is one.
+ @return A new lock.
+ */
++ (id<IMapLock>)lockWithStrategy:(MapLockStrategy)strategy label:(NSString *)label;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* MapLock_h */
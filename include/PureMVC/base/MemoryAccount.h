@@ -0,0 +1,203 @@
+//
+//  MemoryAccount.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef MemoryAccount_h
+#define MemoryAccount_h
+
+#import <Foundation/Foundation.h>
+#import "Instrumentation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// What framework memory is accounted for.
+typedef NS_ENUM(NSUInteger, MemoryCategory) {
+    /// `Observer`s created by the `View` for mediators and by the `Controller` for commands.
+    MemoryCategoryObserver,
+    /// Observer list storage, and the copy each `notifyObservers:` takes.
+    MemoryCategoryObserverList,
+    /// Mediator, Proxy, Proxy factory and command map entries.
+    MemoryCategoryMap,
+    /// `Notification`s created by `sendNotification:`.
+    MemoryCategoryNotification,
+    /// `ICommand`s created to handle notifications, including *SubCommands*.
+    MemoryCategoryCommand,
+};
+
+/// The bytes accounted for one map entry: a key and a value slot.
+enum { MemoryAccountEntrySize = 2 * sizeof(void *) };
+
+/**
+ The bytes accounted for an object, its instance size.
+
+ @param object The object.
+ @return The instance size of its class.
+ */
+FOUNDATION_EXPORT size_t MemoryAccountSize(id object);
+
+/**
+ The bytes accounted for one `Observer`, on registration and on removal
+ alike, since a removal does not see the observer it drops.
+
+ @return The instance size of `Observer`.
+ */
+FOUNDATION_EXPORT size_t MemoryAccountObserverSize(void);
+
+/// Whether memory accounting is on, a single relaxed load; always NO when compiled out.
+static inline BOOL MemoryAccountingActive(void) {
+#if PUREMVC_INSTRUMENTATION && !defined(__cplusplus)
+    return (InstrumentationActiveFlags() & InstrumentationFlagMemory) != 0;
+#else
+    return NO;
+#endif
+}
+
+/**
+ Memory attributed to one Core, by multiton key.
+
+ While `MemoryAccount.enabled` is set, the `Facade`, `Model`, `View`,
+ `Controller` and `MacroCommand` record the memory they allocate on
+ behalf of a Core into its account, by `MemoryCategory`:
+
+ - live bytes, for storage the Core holds until it is removed:
+   observers, observer lists and map entries;
+ - allocation counts and cumulative bytes, for everything including
+   short-lived notifications, commands and observer list copies.
+
+ Sizes are instance sizes and slot sizes, an approximation of what
+ the allocator hands out. Registered proxies and mediators adopting
+ `IMemoryFootprint` are summed into `payloadBytes` when it is read.
+
+ Each Core's actors share one account, created when they are created
+ while accounting is on, or when they first record into it, and
+ removed by `Facade.removeCore:`. Cores never accounted for have none. Accounting is off by default; recording is
+ lock-free. Turn it on before the Cores to measure are populated:
+ storage registered earlier is not counted as live, and releasing
+ it makes live bytes negative.
+
+ @see IMemoryFootprint
+ */
+@interface MemoryAccount : NSObject
+
+/// Whether memory is accounted, off by default; always NO when `PUREMVC_INSTRUMENTATION` is 0.
+@property (class, nonatomic, getter=isEnabled) BOOL enabled;
+
+/// The account of the Core whose command is executing on this thread, set by `Controller.executeCommand:` while accounting.
+@property (class, nonatomic, nullable) MemoryAccount *current;
+
+/// The multiton key of the Core.
+@property (nonatomic, copy, readonly) NSString *multitonKey;
+
+/// The number of allocations recorded, in every category.
+@property (nonatomic, readonly) uint64_t allocations;
+
+/// The bytes allocated, in every category, including those since released.
+@property (nonatomic, readonly) uint64_t allocatedBytes;
+
+/// The bytes the Core's framework storage currently holds.
+@property (nonatomic, readonly) int64_t liveBytes;
+
+/// The `memoryFootprint` of the registered `IMemoryFootprint` proxies and mediators, computed on each read.
+@property (nonatomic, readonly) NSUInteger payloadBytes;
+
+/**
+ The account of a Core, created if needed.
+
+ @param key The multiton key of the Core.
+ @return The Core's account.
+ */
++ (MemoryAccount *)getInstance:(NSString *)key;
+
+/**
+ The account of a Core, if it has one.
+
+ @param key The multiton key of the Core.
+ @return The Core's account, or nil.
+ */
++ (nullable MemoryAccount *)accountForKey:(NSString *)key;
+
+/**
+ Remove the account of a Core.
+
+ @param key The multiton key of the Core.
+ */
++ (void)removeAccount:(NSString *)key;
+
+/**
+ The number of allocations recorded in a category.
+
+ @param category The category.
+ @return The allocation count.
+ */
+- (uint64_t)allocationsInCategory:(MemoryCategory)category;
+
+/**
+ The bytes allocated in a category, including those since released.
+
+ @param category The category.
+ @return The cumulative bytes.
+ */
+- (uint64_t)allocatedBytesInCategory:(MemoryCategory)category;
+
+/**
+ The bytes currently held in a category.
+
+ @param category The category.
+ @return The live bytes.
+ */
+- (int64_t)liveBytesInCategory:(MemoryCategory)category;
+
+/**
+ Record storage the Core holds until it is released.
+
+ @param category The category.
+ @param bytes The bytes allocated.
+ */
+- (void)recordAllocation:(MemoryCategory)category bytes:(size_t)bytes;
+
+/**
+ Record the release of storage recorded with `recordAllocation:bytes:`.
+
+ @param category The category.
+ @param bytes The bytes released.
+ */
+- (void)recordRelease:(MemoryCategory)category bytes:(size_t)bytes;
+
+/**
+ Record a short-lived allocation, counted but not held.
+
+ @param category The category.
+ @param bytes The bytes allocated.
+ */
+- (void)recordTransient:(MemoryCategory)category bytes:(size_t)bytes;
+
+/**
+ Add a source of objects whose `IMemoryFootprint` counts toward `payloadBytes`.
+
+ `Model` and `View` add their registered proxies and mediators.
+
+ @param source Returns the objects, or nil once the source is gone and should be dropped.
+ */
+- (void)addPayloadSource:(NSArray * _Nullable (^)(void))source;
+
+/**
+ The account as a JSON-compatible dictionary: `key`, `allocations`,
+ `allocated_bytes`, `live_bytes`, `payload_bytes` and a `categories`
+ dictionary with the same counters per category.
+
+ @return The report.
+ */
+- (NSDictionary<NSString *, id> *)report;
+
+/// Clear the allocation counts and cumulative bytes; live bytes are kept.
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* MemoryAccount_h */
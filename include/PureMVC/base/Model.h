@@ -23,6 +23,12 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @interface Model : NSObject <IModel>
 
+/// Name of the notification sent when an `IAsyncProxy` finishes loading. The body is the Proxy, the type its name.
++ (NSString *)PROXY_READY;
+
+/// Name of the notification sent when an `IAsyncProxy` fails to load. The body is the `NSError`, the type the Proxy name.
++ (NSString *)PROXY_FAILED;
+
 /**
  Retrieve the `Model` instance for the given multiton key. If it does not exist,
  the factory block is called to create it.
@@ -34,7 +40,7 @@ NS_ASSUME_NONNULL_BEGIN
 + (id<IModel>) getInstance:(NSString *)key factory:(id<IModel> (^)(NSString *key))factory;
 
 /**
- Remove the `Model` instance for a given key.
+ Remove the `Model` instance for a given key, along with every `IProxy` registered with it.
 
  @param key The multiton key of the `Model` instance to remove.
  */
@@ -58,6 +64,99 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype) initWithKey:(NSString *)key;
 
+/**
+ Initializer seeding the `Model` with Proxy factories, typically from `CoreTemplate`.
+
+ @param key The multiton key for this `Model` instance.
+ @param proxyFactories Proxy factories keyed by Proxy name, created lazily on first retrieval.
+ @return A new `Model` instance.
+ */
+- (instancetype) initWithKey:(NSString *)key proxyFactories:(NSDictionary<NSString *, id<IProxy> (^)(void)> *)proxyFactories;
+
+/// A snapshot of the registered `IProxy` instances.
+@property (nonatomic, copy, readonly) NSArray<id<IProxy>> *proxies;
+
+/// A snapshot of the registered Proxy factories, keyed by Proxy name.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id<IProxy> (^)(void)> *proxyFactories;
+
+/**
+ Queue on which `IAsyncProxy` instances load, and `awaitProxies:completion:` completes.
+
+ Defaults to the global concurrent queue, so independent loads overlap.
+ */
+@property (nonatomic, strong) dispatch_queue_t loadQueue;
+
+/**
+ Block the calling thread until a set of proxies have finished loading.
+
+ Do not call this from `loadQueue` if it is a serial queue.
+
+ @param proxyNames The names of the proxies to wait for.
+ @param timeout The maximum number of seconds to wait.
+ @return YES if every Proxy finished loading before the timeout.
+ */
+- (BOOL)waitForProxies:(NSArray<NSString *> *)proxyNames timeout:(NSTimeInterval)timeout;
+
+/**
+ Remove every `IProxy` and Proxy factory from the `Model`.
+
+ The registrations are dropped in a single barrier, then each
+ removed `IProxy` is sent `onRemove`.
+
+ @return The proxies that were removed.
+ */
+- (NSArray<id<IProxy>> *)removeAllProxies;
+
+/**
+ Memory budget, in bytes, for proxies that adopt `IMemoryFootprint`.
+
+ When non-zero, the least recently retrieved proxies that were
+ registered with a factory are removed (and sent `onRemove`) until
+ the combined footprint fits the budget. Evicted proxies are
+ recreated by their factory the next time they are retrieved.
+ Defaults to 0, which disables budget mode.
+ */
+@property (nonatomic) NSUInteger memoryBudget;
+
+/// Number of retrievals that found a live proxy while budget mode was enabled.
+@property (nonatomic, readonly) NSUInteger cacheHits;
+
+/// Number of retrievals that created a proxy from its factory while budget mode was enabled.
+@property (nonatomic, readonly) NSUInteger cacheMisses;
+
+/// Number of proxies evicted to stay within the memory budget.
+@property (nonatomic, readonly) NSUInteger cacheEvictions;
+
+/**
+ Reset the hit, miss and eviction counters to zero.
+ */
+- (void)resetCacheStatistics;
+
+/**
+ Write the data of every registered `ISnapshotProxy` to a binary snapshot file.
+
+ Snapshot entries that were loaded but not yet restored are carried
+ over, so proxies that were never retrieved keep their data.
+
+ @param url The file URL to write the snapshot to. The file is replaced atomically.
+ @param error On failure, the reason the snapshot could not be written.
+ @return YES if the snapshot was written.
+ */
+- (BOOL)writeSnapshotToURL:(NSURL *)url error:(NSError **)error;
+
+/**
+ Memory-map a snapshot file previously written by `writeSnapshotToURL:error:`.
+
+ Only the snapshot index is read. Each `ISnapshotProxy` is restored
+ from its mapped bytes when it is next registered, which for a factory
+ registered Proxy is its first retrieval.
+
+ @param url The file URL of the snapshot.
+ @param error On failure, the reason the snapshot could not be loaded.
+ @return YES if the snapshot was mapped and its index is valid.
+ */
+- (BOOL)loadSnapshotFromURL:(NSURL *)url error:(NSError **)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,78 @@
+//
+//  MultitonRegistry.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef MultitonRegistry_h
+#define MultitonRegistry_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A concurrent map of Multiton instances by key.
+
+ `Facade`, `Model`, `View` and `Controller` keep their Multiton
+ instances in a `MultitonRegistry`. Looking up an existing key takes
+ no lock. Keys are spread over independently locked shards, and a
+ shard's lock is taken only to publish or remove an instance, so
+ lookups never wait on a Core being created. Factories run one at a
+ time per registry, under a recursive creation lock.
+ */
+@interface MultitonRegistry<ObjectType> : NSObject
+
+/**
+ Factory method to create a new, empty `MultitonRegistry`.
+
+ @return A new `MultitonRegistry` instance.
+ */
++ (instancetype)registry;
+
+/**
+ Look up the instance for a key without taking a lock.
+
+ @param key The multiton key.
+ @return The instance registered for the key, or nil.
+ */
+- (nullable ObjectType)objectForKey:(NSString *)key;
+
+/**
+ Look up the instance for a key, creating it if there is none.
+
+ The factory is called at most once per key, under the registry's
+ recursive creation lock, not the key's shard lock; concurrent callers
+ for the same key wait and receive the instance it created. Creation
+ is not sharded: factories for different keys of one registry run one
+ at a time, and a factory may create instances in other registries.
+
+ @param key The multiton key.
+ @param factory Returns a new instance for the key.
+ @return The instance registered for the key.
+ */
+- (ObjectType)objectForKey:(NSString *)key factory:(ObjectType (^)(NSString *key))factory;
+
+/**
+ Register an instance for a key, replacing any existing one.
+
+ @param object The instance.
+ @param key The multiton key.
+ */
+- (void)setObject:(ObjectType)object forKey:(NSString *)key;
+
+/**
+ Remove the instance for a key.
+
+ @param key The multiton key.
+ @return The instance that was removed, or nil.
+ */
+- (nullable ObjectType)removeObjectForKey:(NSString *)key;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* MultitonRegistry_h */
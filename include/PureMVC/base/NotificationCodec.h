@@ -0,0 +1,110 @@
+//
+//  NotificationCodec.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef NotificationCodec_h
+#define NotificationCodec_h
+
+#import <Foundation/Foundation.h>
+#import "INotification.h"
+#import "IBodyCodec.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A versioned, compact binary encoding of `INotification`.
+
+ Names and types found in the codec's table of interned strings are
+ encoded as a 4 byte ID, others inline as UTF-8. An `NSData` body is
+ written as is, any other body goes through the `IBodyCodec`.
+
+ Decoding does not copy the body: an `NSData` body is a slice of the
+ decoded buffer, which it keeps alive.
+
+ Both ends must use the same interned strings, in the same order.
+
+ @see IBodyCodec
+ */
+@interface NotificationCodec : NSObject
+
+/// The version of the encoding, written into every encoded notification.
++ (uint8_t)VERSION;
+
+/// The interned strings; the ID of each is its index plus one.
+@property (nonatomic, copy, readonly) NSArray<NSString *> *names;
+
+/// The codec for bodies that are not `NSData`, if any.
+@property (nonatomic, strong, readonly, nullable) id<IBodyCodec> bodyCodec;
+
+/**
+ Factory method to create a codec without interned strings or a body codec.
+
+ @return A new `NotificationCodec` instance.
+ */
++ (instancetype)codec;
+
+/**
+ Factory method to create a `NotificationCodec`.
+
+ @param names The notification names and types to intern.
+ @param bodyCodec The codec for bodies that are not `NSData`, or nil.
+ @return A new `NotificationCodec` instance.
+ */
++ (instancetype)withNames:(NSArray<NSString *> *)names bodyCodec:(nullable id<IBodyCodec>)bodyCodec;
+
+/**
+ Designated initializer.
+
+ @param names The notification names and types to intern.
+ @param bodyCodec The codec for bodies that are not `NSData`, or nil.
+ @return An initialized `NotificationCodec` instance.
+ */
+- (instancetype)initWithNames:(NSArray<NSString *> *)names bodyCodec:(nullable id<IBodyCodec>)bodyCodec;
+
+/**
+ Encode a notification.
+
+ @param notification The notification to encode.
+ @return The encoded bytes.
+ @note Raises `NotificationCodecException` if the body is neither `NSData` nor handled by the body codec.
+ */
+- (NSData *)encode:(id<INotification>)notification;
+
+/**
+ Encode a notification, appending it to a buffer.
+
+ @param notification The notification to encode.
+ @param buffer The buffer to append to, reusable across calls.
+ @note Raises `NotificationCodecException` if the body is neither `NSData` nor handled by the body codec.
+ */
+- (void)encode:(id<INotification>)notification into:(NSMutableData *)buffer;
+
+/**
+ Decode a notification.
+
+ @param data The encoded bytes.
+ @param error On failure, the reason the bytes could not be decoded.
+ @return The notification, or nil on failure.
+ */
+- (nullable id<INotification>)decode:(NSData *)data error:(NSError **)error;
+
+/**
+ Decode a notification from dispatch data, such as read from a `dispatch_io` channel.
+
+ An `NSData` body is a subrange of `data`.
+
+ @param data The encoded bytes.
+ @param error On failure, the reason the bytes could not be decoded.
+ @return The notification, or nil on failure.
+ */
+- (nullable id<INotification>)decodeDispatchData:(dispatch_data_t)data error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* NotificationCodec_h */
@@ -32,6 +32,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// The Multiton `Facade` through which notifications are sent.
 @property (nonatomic, weak) id<IFacade>facade;
 
+/// The multiton key given by `initializeNotifier:`, nil until then.
+@property (nonatomic, copy, readonly, nullable) NSString *multitonKey;
+
 @end
 
 NS_ASSUME_NONNULL_END
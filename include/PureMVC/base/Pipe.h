@@ -0,0 +1,119 @@
+//
+//  Pipe.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Pipe_h
+#define Pipe_h
+
+#import <Foundation/Foundation.h>
+#import "INotification.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A bounded, lock-free inbound message pipe for a Core.
+
+ Any number of threads, typically other Cores, write notifications
+ into a Core's pipe without blocking. The pipe drains on its own
+ serial executor and forwards each notification, in write order per
+ writer, to the `View.notifyObservers:` of its Core, so the writer
+ never runs the receiving Core's observers on its own thread.
+
+ A Core's pipe is a Multiton keyed by the Core's multiton key, and is
+ closed and removed along with the Core by `Facade.removeCore:`.
+
+ @see View
+ @see Facade
+ */
+@interface Pipe : NSObject
+
+/// The multiton key of the Core this pipe delivers to.
+@property (nonatomic, copy, readonly) NSString *multitonKey;
+
+/// The maximum number of notifications in flight, a power of two.
+@property (nonatomic, readonly) NSUInteger capacity;
+
+/// The serial queue on which the pipe drains into its Core's `View`.
+@property (nonatomic, strong, readonly) dispatch_queue_t executor;
+
+/**
+ Pipe Multiton Factory method.
+
+ @param key The multiton key of the receiving Core.
+ @param factory A block returning a new `Pipe` if none exists for the key.
+ @return The `Pipe` for the key.
+ */
++ (Pipe *)getInstance:(NSString *)key factory:(Pipe *(^)(NSString *key))factory;
+
+/**
+ Close and remove the `Pipe` for a given key.
+
+ Notifications still in the pipe are discarded.
+
+ @param key The multiton key of the receiving Core.
+ */
++ (void)removePipe:(NSString *)key;
+
+/**
+ Write a notification to the pipe of a Core.
+
+ The pipe is not created; a Core receives through a pipe created with
+ `getInstance:factory:` or by `Bus.subscribe:topic:`.
+
+ @param notification The notification to deliver.
+ @param key The multiton key of the receiving Core.
+ @return NO if the Core has no pipe, or its pipe is full or closed.
+ */
++ (BOOL)write:(id<INotification>)notification toCore:(NSString *)key;
+
+/**
+ Factory method to create a new `Pipe` with a capacity of 1024.
+
+ @param key The multiton key of the receiving Core.
+ @return A new `Pipe` instance.
+ */
++ (instancetype)withKey:(NSString *)key;
+
+/**
+ Factory method to create a new `Pipe`.
+
+ @param key The multiton key of the receiving Core.
+ @param capacity The number of notifications the pipe holds, rounded up to a power of two.
+ @return A new `Pipe` instance.
+ */
++ (instancetype)withKey:(NSString *)key capacity:(NSUInteger)capacity;
+
+/**
+ Designated initializer.
+
+ This constructor should not be called directly. Instead, use `getInstance:factory:`.
+
+ @param key The multiton key of the receiving Core.
+ @param capacity The number of notifications the pipe holds, rounded up to a power of two.
+ @return An initialized `Pipe` instance.
+ @note Raises an exception if a `Pipe` already exists for the key.
+ */
+- (instancetype)initWithKey:(NSString *)key capacity:(NSUInteger)capacity;
+
+/**
+ Write a notification to the pipe without blocking.
+
+ @param notification The notification to deliver.
+ @return NO if the pipe is full or closed, in which case the notification is not delivered.
+ */
+- (BOOL)write:(id<INotification>)notification;
+
+/**
+ Close the pipe. Later writes fail, and notifications still in the pipe are discarded.
+ */
+- (void)close;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Pipe_h */
@@ -0,0 +1,88 @@
+//
+//  Probes.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Probes_h
+#define Probes_h
+
+/**
+ USDT static probes on the dispatch paths, for `perf` and `bpftrace`.
+
+ Compiled in on Linux when `<sys/sdt.h>` is available (systemtap-sdt-dev),
+ unless `PUREMVC_PROBES` is defined as 0. Every probe belongs to the
+ `puremvc` provider and has a semaphore: while no tracer is attached a
+ probe site costs a load and a not-taken branch, and its arguments are
+ not evaluated. Elsewhere the macros expand to nothing.
+
+ String arguments are UTF-8 C strings; the first is always the
+ multiton key of the Core.
+
+ | Probe               | Arguments                                  |
+ |---------------------|--------------------------------------------|
+ | `notify_start`      | key, notification name                     |
+ | `notify_end`        | key, notification name                     |
+ | `observer_invoke`   | key, notification name, context class name |
+ | `command_execute`   | key, notification name, command class name |
+ | `proxy_register`    | key, proxy name                            |
+ | `proxy_remove`      | key, proxy name                            |
+ | `mediator_register` | key, mediator name                         |
+ | `mediator_remove`   | key, mediator name                         |
+
+ For example: `bpftrace -e 'usdt:./libPureMVC.so:puremvc:notify_start { printf("%s %s\n", str(arg0), str(arg1)); }'`
+
+ This header is used by the framework sources and is not part of the
+ umbrella header.
+ */
+#ifndef PUREMVC_PROBES
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define PUREMVC_PROBES 1
+#endif
+#endif
+#endif
+
+#ifndef PUREMVC_PROBES
+#define PUREMVC_PROBES 0
+#endif
+
+#if PUREMVC_PROBES
+
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+/// The semaphore a tracer increments while attached to a probe.
+#define PUREMVC_PROBE_SEMAPHORE(probe) puremvc_##probe##_semaphore
+
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(notify_start);
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(notify_end);
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(observer_invoke);
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(command_execute);
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(proxy_register);
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(proxy_remove);
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(mediator_register);
+extern unsigned short PUREMVC_PROBE_SEMAPHORE(mediator_remove);
+
+/// Whether a tracer is attached to a probe.
+#define PUREMVC_PROBE_ACTIVE(probe) __builtin_expect(PUREMVC_PROBE_SEMAPHORE(probe) != 0, 0)
+
+/// Fire a probe with two string arguments, evaluated only while attached.
+#define PUREMVC_PROBE2(probe, a, b) \
+    do { if (PUREMVC_PROBE_ACTIVE(probe)) DTRACE_PROBE2(puremvc, probe, (a), (b)); } while (0)
+
+/// Fire a probe with three string arguments, evaluated only while attached.
+#define PUREMVC_PROBE3(probe, a, b, c) \
+    do { if (PUREMVC_PROBE_ACTIVE(probe)) DTRACE_PROBE3(puremvc, probe, (a), (b), (c)); } while (0)
+
+#else
+
+#define PUREMVC_PROBE_ACTIVE(probe) 0
+#define PUREMVC_PROBE2(probe, a, b) do { } while (0)
+#define PUREMVC_PROBE3(probe, a, b, c) do { } while (0)
+
+#endif
+
+#endif /* Probes_h */
@@ -0,0 +1,105 @@
+//
+//  SharedMemoryTransport.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef SharedMemoryTransport_h
+#define SharedMemoryTransport_h
+
+#import <Foundation/Foundation.h>
+#import "INotification.h"
+#import "NotificationCodec.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A notification transport between a local Core and a Core in another
+ process on the same host, over a POSIX shared-memory segment.
+
+ The segment holds one ring buffer per direction. One process creates
+ the segment and the other opens it by name. Writing a notification
+ encodes its name, type and `NSData` body straight into the peer's
+ ring; the local side polls its own ring on a serial reader queue and
+ re-injects each notification into `View.notifyObservers:` of the local
+ Core. Neither path makes a system call while there is data to move, and
+ the reader backs off while its ring stays empty. A malformed record
+ from the peer closes the transport.
+
+ @see Pipe
+ */
+@interface SharedMemoryTransport : NSObject
+
+/// The name of the shared-memory segment.
+@property (nonatomic, copy, readonly) NSString *name;
+
+/// The multiton key of the local Core that receives notifications.
+@property (nonatomic, copy, readonly) NSString *multitonKey;
+
+/// The size of each ring buffer in bytes, a power of two.
+@property (nonatomic, readonly) NSUInteger capacity;
+
+/**
+ Create a shared-memory segment and connect the local Core to it.
+
+ @param name The segment name, starting with a slash, e.g. @"/myapp.workers".
+ @param key The multiton key of the local Core.
+ @param capacity The size of each ring buffer in bytes, rounded up to a power of two of at least 4096.
+ @param error On failure, the reason the segment could not be created.
+ @return A new transport, or nil on failure.
+ */
++ (nullable instancetype)createWithName:(NSString *)name key:(NSString *)key capacity:(NSUInteger)capacity error:(NSError **)error;
+
+/**
+ Open a shared-memory segment created by another process and connect the local Core to it.
+
+ @param name The segment name passed to `createWithName:key:capacity:error:`.
+ @param key The multiton key of the local Core.
+ @param error On failure, the reason the segment could not be opened.
+ @return A new transport, or nil on failure.
+ */
++ (nullable instancetype)openWithName:(NSString *)name key:(NSString *)key error:(NSError **)error;
+
+/**
+ Codec encoding notifications written by this side, and decoding those it reads.
+
+ Without a codec, bodies must be nil or `NSData`. Both sides should use
+ the same interned strings and body codec.
+ */
+@property (atomic, strong, nullable) NotificationCodec *codec;
+
+/**
+ Interval, in seconds, at which the reader polls its ring while notifications arrive. Defaults to 0.001.
+
+ Each poll that finds the ring empty doubles the interval, up to `maxPollInterval`.
+ */
+@property (nonatomic) NSTimeInterval pollInterval;
+
+/**
+ Longest interval, in seconds, the reader backs off to while its ring stays empty. Defaults to 0.064.
+
+ It bounds the delay of the first notification after an idle period.
+ */
+@property (nonatomic) NSTimeInterval maxPollInterval;
+
+/**
+ Write a notification to the Core on the other side.
+
+ @param notification The notification. Its body must be nil or `NSData` unless a `codec` is set.
+ @return NO if the peer's ring is full, the notification is larger than half the ring, or the transport is closed.
+ @note Raises `SharedMemoryTransportException` if the body is not `NSData` and no `codec` is set.
+ */
+- (BOOL)write:(id<INotification>)notification;
+
+/**
+ Stop reading and unmap the segment. The creating side also unlinks its name.
+ */
+- (void)close;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* SharedMemoryTransport_h */
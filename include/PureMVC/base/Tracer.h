@@ -0,0 +1,107 @@
+//
+//  Tracer.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Tracer_h
+#define Tracer_h
+
+#import <Foundation/Foundation.h>
+#import "Instrumentation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// What a traced span covers.
+typedef NS_ENUM(uint8_t, TraceCategory) {
+    /// A `View.notifyObservers:` call, named after the notification.
+    TraceCategoryNotify,
+    /// One `IObserver` notified, named after the observer's context class.
+    TraceCategoryObserver,
+    /// A `Controller.executeCommand:` call, named after the command class.
+    TraceCategoryCommand,
+    /// A `MacroCommand` *SubCommand*, named after its class.
+    TraceCategorySubCommand,
+};
+
+/**
+ A process-wide recorder of notification causality in the Chrome
+ trace-event format.
+
+ While `Tracer.enabled` is set, `View`, `Controller` and `MacroCommand`
+ record a span around each notify, observer delivery, command and
+ *SubCommand*. A span begun while another is open on the same thread
+ is its child, so one `sendNotification` yields the tree of everything
+ it caused, across Cores. Each span carries its own id, its parent's id
+ and the multiton key of its Core.
+
+ Spans are recorded into a buffer owned by the recording thread, so
+ tracing does not serialize threads. A buffer grows with its spans up
+ to `bufferCapacity`; later spans are counted in `droppedSpans`. The
+ buffer of an exited thread is reused by the next new thread.
+
+ `traceEventJSON` renders every buffer as trace-event JSON for
+ Perfetto or `chrome://tracing`.
+
+ @see Instrumentation
+ */
+@interface Tracer : NSObject
+
+/// Whether spans are recorded, off by default; always NO when compiled out.
+@property (class, nonatomic, getter=isEnabled) BOOL enabled;
+
+/// The most spans each thread's buffer holds, 65536 by default.
+@property (class, nonatomic) NSUInteger bufferCapacity;
+
+/// The number of spans not recorded because their thread's buffer was full.
+@property (class, nonatomic, readonly) uint64_t droppedSpans;
+
+/**
+ Begin a span on the current thread.
+
+ The span is a child of the innermost span open on this thread.
+
+ @param category What the span covers.
+ @param name The span's name, a string or a class.
+ @param key The multiton key of the span's Core, or nil to use its parent's.
+ @return The id of the span, or 0 if it was not begun.
+ */
++ (uint64_t)beginSpan:(TraceCategory)category name:(id)name core:(nullable NSString *)key;
+
+/**
+ End a span begun on the current thread.
+
+ Spans begun inside it and still open are ended with it.
+
+ @param span The id returned by `beginSpan:name:core:`; 0 is ignored.
+ */
++ (void)endSpan:(uint64_t)span;
+
+/**
+ Render every recorded span as Chrome trace-event JSON.
+
+ @return A JSON object with a `traceEvents` array of complete events.
+ */
++ (NSData *)traceEventJSON;
+
+/**
+ Write `traceEventJSON` to a file.
+
+ @param url The file URL to write to.
+ @param error Receives the error if writing fails.
+ @return YES if the trace was written.
+ */
++ (BOOL)writeToURL:(NSURL *)url error:(NSError **)error;
+
+/**
+ Discard every recorded span, freeing the buffers' storage, and reset `droppedSpans`.
+ */
++ (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Tracer_h */
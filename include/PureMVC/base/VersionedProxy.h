@@ -0,0 +1,59 @@
+//
+//  VersionedProxy.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef VersionedProxy_h
+#define VersionedProxy_h
+
+#import <Foundation/Foundation.h>
+#import "Proxy.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A `Proxy` whose data is an immutable, versioned snapshot.
+
+ Many threads may read `data` while a writer replaces it: readers
+ never lock and never block each other, and each assignment to `data`
+ publishes a new version atomically. A replaced version is released
+ once no reader can still be loading it.
+
+ Treat the data as immutable: assign a new object rather than
+ mutating the current one, for example with `updateData:`.
+ Mediators can compare `version` against the last version they
+ handled to skip redundant work.
+
+ @see VersionedReference
+ */
+@interface VersionedProxy : Proxy
+
+/// The version of the current data, starting at 0 and incremented by each assignment.
+@property (nonatomic, readonly) uint64_t version;
+
+/**
+ Pin the current data together with its version.
+
+ @param version Receives the version of the returned data, if not NULL.
+ @return The current data.
+ */
+- (nullable id)dataWithVersion:(nullable uint64_t *)version;
+
+/**
+ Publish new data derived from the current data.
+
+ Concurrent updates are applied one after another, none are lost.
+
+ @param block Returns the new data given the current data.
+ @return The version of the published data.
+ */
+- (uint64_t)updateData:(id _Nullable (^)(id _Nullable data))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* VersionedProxy_h */
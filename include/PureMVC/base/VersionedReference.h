@@ -0,0 +1,86 @@
+//
+//  VersionedReference.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef VersionedReference_h
+#define VersionedReference_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A reference to an immutable value that readers load without locking.
+
+ Every `store:` publishes a new version of the value. Readers pin the
+ current version with a pair of atomic operations and never block on
+ writers or on each other; writers are serialized with a mutex. A
+ replaced value is released once no reader can still be pinning it.
+
+ Values must not be mutated after they are stored: publish a new value
+ instead, for example with `update:`.
+ */
+@interface VersionedReference<__covariant ObjectType> : NSObject
+
+/// The version of the current value, starting at 0 and incremented by each store.
+@property (nonatomic, readonly) uint64_t version;
+
+/**
+ Factory method to create a new `VersionedReference`.
+
+ @param value The initial value, published as version 0.
+ @return A new `VersionedReference` instance.
+ */
++ (instancetype)withValue:(nullable ObjectType)value;
+
+/**
+ Designated initializer.
+
+ @param value The initial value, published as version 0.
+ @return An initialized `VersionedReference` instance.
+ */
+- (instancetype)initWithValue:(nullable ObjectType)value;
+
+/**
+ Load the current value without taking a lock.
+
+ @return The current value.
+ */
+- (nullable ObjectType)load;
+
+/**
+ Load the current value together with its version.
+
+ @param version Receives the version of the returned value, if not NULL.
+ @return The current value.
+ */
+- (nullable ObjectType)loadWithVersion:(nullable uint64_t *)version;
+
+/**
+ Publish a new value.
+
+ @param value The new value.
+ @return The version of the published value.
+ */
+- (uint64_t)store:(nullable ObjectType)value;
+
+/**
+ Publish a value derived from the current one.
+
+ The block runs while holding the writer lock, so concurrent updates
+ are applied one after another and none are lost.
+
+ @param block Returns the new value given the current one.
+ @return The version of the published value.
+ */
+- (uint64_t)update:(ObjectType _Nullable (^)(ObjectType _Nullable current))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* VersionedReference_h */
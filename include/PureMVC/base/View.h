@@ -11,6 +11,10 @@
 
 #import <Foundation/Foundation.h>
 #import "IView.h"
+#import "Instrumentation.h"
+#import "FlightRecorder.h"
+#import "MemoryAccount.h"
+#import "Watchdog.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -43,7 +47,15 @@ NS_ASSUME_NONNULL_BEGIN
 + (id<IView>) getInstance:(NSString *)key factory:(id<IView> (^)(NSString *key))factory;
 
 /**
- Remove a `IView` instance for a given key.
+ Returns the `IView` instance for the specified Multiton key, without creating one.
+
+ @param key The Multiton key.
+ @return The existing `IView` instance, or nil.
+ */
++ (nullable id<IView>)viewForKey:(NSString *)key;
+
+/**
+ Remove a `IView` instance for a given key, along with every `IMediator` and `IObserver` registered with it.
 
  @param key The Multiton key of the `IView` instance to remove.
  */
@@ -67,6 +79,60 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype) initWithKey:(NSString *)key;
 
+/// Latency and fanout histograms of this Core's `notifyObservers:` and `Controller.executeCommand:`.
+@property (nonatomic, strong, readonly) Instrumentation *instrumentation;
+
+/// Ring of the notifications this Core most recently sent, for post-mortem inspection.
+@property (nonatomic, strong, readonly) FlightRecorder *flightRecorder;
+
+/// Memory attributed to this Core, shared with its `Model`, `Controller` and `Facade`; created on first use.
+@property (nonatomic, strong, readonly) MemoryAccount *memoryAccount;
+
+/// Latency budgets of this Core's observers and of its `Controller`'s commands.
+@property (nonatomic, strong, readonly) Watchdog *watchdog;
+
+/// A snapshot of the registered `IMediator` instances.
+@property (nonatomic, copy, readonly) NSArray<id<IMediator>> *mediators;
+
+/**
+ Register one `IObserver` for several notifications in a single barrier.
+
+ @param observer The `IObserver` to register.
+ @param notificationNames The names of the notifications to observe.
+ */
+- (void)registerObserver:(id<IObserver>)observer notificationNames:(NSArray<NSString *> *)notificationNames;
+
+/**
+ Remove the `IObserver` of a context from several notifications in a single barrier.
+
+ @param notificationNames The names of the notifications to stop observing.
+ @param context The notify context of the `IObserver` to remove.
+ */
+- (void)removeObservers:(NSArray<NSString *> *)notificationNames context:(id)context;
+
+/**
+ Register several `IMediator` instances at once.
+
+ The mediator and observer maps are each updated in a single
+ barrier, then every newly registered `IMediator` is sent `onRegister`.
+ Mediators whose name is already registered are skipped.
+
+ @param mediators The `IMediator` instances to register.
+ */
+- (void)registerMediators:(NSArray<id<IMediator>> *)mediators;
+
+/**
+ Remove every `IMediator`, and the `IObserver`s of their notification
+ interests, from the `View`.
+
+ The registrations are dropped in a single barrier per map, then
+ each removed `IMediator` is sent `onRemove`. Observers registered
+ by others, such as the `Controller`'s, are left in place.
+
+ @return The mediators that were removed.
+ */
+- (NSArray<id<IMediator>> *)removeAllMediators;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,123 @@
+//
+//  Watchdog.h
+//  PureMVC Objective-C Multicore
+//
+//  Copyright(c) 2025 Saad Shams <saad.shams@puremvc.org>
+//  Your reuse is governed by the BSD 3-Clause License
+//
+
+#ifndef Watchdog_h
+#define Watchdog_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Called with each delivery or command that overran its budget.
+
+ @param multitonKey The multiton key of the Core.
+ @param notificationName The name of the notification delivered.
+ @param contextClass The class of the observer's context, or of the command.
+ @param latency The time taken, in nanoseconds.
+ @param budget The budget exceeded, in nanoseconds.
+ */
+typedef void (^WatchdogHandler)(NSString *multitonKey, NSString *notificationName, Class contextClass, uint64_t latency, uint64_t budget);
+
+/**
+ Latency budgets of a Core's observers and commands.
+
+ Each `View` owns a `Watchdog`. While `Watchdog.enabled` is set, its
+ `notifyObservers:` times each observer and its `Controller`'s
+ `executeCommand:` times each command with two monotonic clock reads,
+ and checks the time against the budget. An overrun is counted and
+ passed to `handler`, or logged naming the offending class when there
+ is no handler. Checks run on the notifying thread, the watchdog has
+ no thread of its own.
+
+ A budget set for a context class, matched exactly, takes precedence
+ over one set for a notification name, which takes precedence over
+ `defaultBudget`. A budget of 0 means none. When no budget could be
+ exceeded, a check is a single comparison.
+
+ @see View
+ */
+@interface Watchdog : NSObject
+
+/// Whether Views and Controllers check, off by default; always NO when `PUREMVC_INSTRUMENTATION` is 0.
+@property (class, nonatomic, getter=isEnabled) BOOL enabled;
+
+/// The multiton key of the watched Core.
+@property (nonatomic, copy, readonly) NSString *multitonKey;
+
+/// The budget of every delivery without a budget of its own, in nanoseconds; 0, the default, for none.
+@property (nonatomic) uint64_t defaultBudget;
+
+/// Called with each overrun, on the notifying thread; when nil, overruns are logged.
+@property (atomic, copy, nullable) WatchdogHandler handler;
+
+/// The number of overruns since creation.
+@property (nonatomic, readonly) uint64_t violationCount;
+
+/**
+ Factory method to create a `Watchdog` for a Core.
+
+ @param key The multiton key of the Core.
+ @return A new `Watchdog` instance.
+ */
++ (instancetype)withKey:(NSString *)key;
+
+/**
+ Designated initializer.
+
+ @param key The multiton key of the Core.
+ @return An initialized `Watchdog` instance.
+ */
+- (instancetype)initWithKey:(NSString *)key;
+
+/**
+ Set the budget of each delivery of a notification, and of its command.
+
+ @param budget The budget in nanoseconds, or 0 to remove it.
+ @param notificationName The name of the notification.
+ */
+- (void)setBudget:(uint64_t)budget forNotification:(NSString *)notificationName;
+
+/**
+ Set the budget of each delivery to observers whose context is of a class,
+ and of each execution of a command of that class.
+
+ @param budget The budget in nanoseconds, or 0 to remove it.
+ @param contextClass The class of the observer's context or of the command.
+ */
+- (void)setBudget:(uint64_t)budget forContextClass:(Class)contextClass;
+
+/**
+ The budget applying to a delivery.
+
+ @param notificationName The name of the notification.
+ @param contextClass The class of the observer's context or of the command.
+ @return The budget in nanoseconds, or 0 for none.
+ */
+- (uint64_t)budgetForNotification:(NSString *)notificationName contextClass:(Class)contextClass;
+
+/**
+ Check a delivery against its budget, reporting an overrun.
+
+ @param notificationName The name of the notification.
+ @param contextClass The class of the observer's context or of the command.
+ @param latency The time taken, in nanoseconds.
+ @return Whether the budget was exceeded.
+ */
+- (BOOL)checkNotification:(NSString *)notificationName contextClass:(Class)contextClass latency:(uint64_t)latency;
+
+/**
+ Remove every budget, including `defaultBudget`.
+ */
+- (void)removeAllBudgets;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* Watchdog_h */